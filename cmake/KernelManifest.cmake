@@ -8,6 +8,24 @@
 # kernel builds explicitly under the kernel directory breaks the natural library encapsulation. Instead, files compiled
 # into the kernel are flagged individually and aggregated. This file manages the list of flagged files.
 
+# flags that make user-mode compilation kernel-compatible
+#
+# target_sources_kernel() applies these to each file as it registers it, so they must be set before the first call. The
+# kernel build also forwards them to Kbuild for c++ files.
+set(kernel_c_flags -ffreestanding)
+set(kernel_cxx_flags
+    "${CMAKE_CXX${CMAKE_CXX_STANDARD}_STANDARD_COMPILE_OPTION}"
+    ${compile_options_common}
+    -Wframe-larger-than=1024
+    -fno-builtin
+    -fno-exceptions
+    -fno-rtti
+    -fno-threadsafe-statics
+    -fno-use-cxa-atexit
+    -nostdlib
+    -g0
+)
+
 # global property to collect absolute paths to each file that goes into the kernel build
 define_property(GLOBAL PROPERTY kernel_manifest
     BRIEF_DOCS "list of sources to include in Kbuild"
@@ -127,6 +127,17 @@ if (CMAKE_CXX_COMPILER_ID STREQUAL "MSVC")
     )
 endif()
 
+# ---------------------------------------------------------------------------------------------------------------------
+# Latency Histograms
+# ---------------------------------------------------------------------------------------------------------------------
+
+# The input pipeline's stages are timed with rdtsc and counted into per-cpu histograms. This costs a few dozen cycles
+# per stage, so it is off by default.
+option(ENABLE_LATENCY_HISTOGRAMS "Count input pipeline stage latencies into histograms." OFF)
+if (ENABLE_LATENCY_HISTOGRAMS)
+    list(APPEND compile_options_common -DCRV_ENABLE_LATENCY_HISTOGRAMS)
+endif()
+
 target_compile_options(project_options INTERFACE ${compile_options_common})
 
 # ---------------------------------------------------------------------------------------------------------------------
@@ -0,0 +1,168 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief lock-free double buffer publishing large values to concurrent readers
+///
+/// This type is shared between the kernel module and user mode, so it uses compiler atomic builtins rather than
+/// std::atomic, which is not available freestanding.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <array>
+#include <cassert>
+#include <utility>
+
+namespace crv {
+
+namespace double_buffer_waits {
+
+/// busy waits with a pause hint, like the kernel's cpu_relax()
+struct spin_t
+{
+    auto operator()() const noexcept -> void
+    {
+#if defined __x86_64__ || defined __i386__
+        __builtin_ia32_pause();
+#endif
+    }
+};
+
+} // namespace double_buffer_waits
+
+/// two copies of a value: one published to readers, one staged by the writer
+///
+/// Readers pin the published slot by incrementing its reader count, then confirm it is still published. If a commit
+/// landed in between, they unpin and try again, so a reader only retries once per commit that races it. Readers never
+/// wait on the writer, never block, and never see a slot being written.
+///
+/// The writer pays for everything else. Before it can write the unpublished slot, it waits for readers still pinning
+/// it from before the last commit to leave. Commits themselves are a single store, so readers that arrive afterward
+/// go straight to the new value, and the old value remains intact for readers already inside it.
+///
+/// Concurrent readers share a slot, so values must not change under const access. State a reader updates as it goes,
+/// like a spline's locate cursor, belongs to the reader.
+///
+/// \pre writer calls are serialized by the caller
+template <typename t_value_t, typename t_wait_t = double_buffer_waits::spin_t> class double_buffer_t
+{
+public:
+    using value_t = t_value_t;
+    using wait_t = t_wait_t;
+
+    /// pins the published slot for as long as it lives
+    class read_guard_t
+    {
+    public:
+        explicit read_guard_t(double_buffer_t const& double_buffer) noexcept
+            : double_buffer_{&double_buffer}, slot_index_{double_buffer.pin()}
+        {}
+
+        ~read_guard_t() { double_buffer_->unpin(slot_index_); }
+
+        read_guard_t(read_guard_t const&) = delete;
+        auto operator=(read_guard_t const&) -> read_guard_t& = delete;
+
+        auto operator*() const noexcept -> value_t const& { return double_buffer_->slots_[slot_index_].value; }
+        auto operator->() const noexcept -> value_t const* { return &**this; }
+
+    private:
+        double_buffer_t const* double_buffer_;
+        int_t slot_index_;
+    };
+
+    double_buffer_t() = default;
+
+    explicit double_buffer_t(value_t const& value, wait_t wait = {}) noexcept : wait_{std::move(wait)}
+    {
+        slots_[0].value = value;
+        slots_[1].value = value;
+    }
+
+    double_buffer_t(double_buffer_t const&) = delete;
+    auto operator=(double_buffer_t const&) -> double_buffer_t& = delete;
+
+    // ----------------------------------------------------------------------------------------------------------------
+    // Readers
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /// pins the published value until the guard is destroyed
+    auto read() const noexcept -> read_guard_t { return read_guard_t{*this}; }
+
+    /// calls visitor with the published value, pinned for the duration of the call
+    template <typename visitor_t> auto read(visitor_t&& visitor) const noexcept -> decltype(auto)
+    {
+        auto const guard = read();
+        return std::forward<visitor_t>(visitor)(*guard);
+    }
+
+    // ----------------------------------------------------------------------------------------------------------------
+    // Writer
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /// waits for readers to leave the unpublished slot, then returns it for writing in place
+    ///
+    /// Staging again before committing returns the same slot without waiting.
+    auto stage() noexcept -> value_t&
+    {
+        auto& slot = slots_[1 - __atomic_load_n(&published_index_, __ATOMIC_RELAXED)];
+        while (__atomic_load_n(&slot.reader_count, __ATOMIC_SEQ_CST) != 0) wait_();
+        return slot.value;
+    }
+
+    /// publishes the staged slot
+    ///
+    /// \pre stage() was called since the last commit
+    auto commit() noexcept -> void
+    {
+        auto const staged_index = 1 - __atomic_load_n(&published_index_, __ATOMIC_RELAXED);
+        __atomic_store_n(&published_index_, staged_index, __ATOMIC_SEQ_CST);
+    }
+
+    /// stages a copy of value and commits it
+    auto publish(value_t const& value) noexcept -> void
+    {
+        stage() = value;
+        commit();
+    }
+
+private:
+    auto pin() const noexcept -> int_t
+    {
+        for (;;)
+        {
+            auto const slot_index = __atomic_load_n(&published_index_, __ATOMIC_RELAXED);
+            auto& reader_count = slots_[slot_index].reader_count;
+            __atomic_fetch_add(&reader_count, 1, __ATOMIC_SEQ_CST);
+
+            // Confirming the slot is still published after pinning it orders the two against the writer's commit
+            // followed by its drain check: either the writer sees this reader's count, or this reader sees the commit.
+            if (__atomic_load_n(&published_index_, __ATOMIC_SEQ_CST) == slot_index) [[likely]] return slot_index;
+
+            // a commit raced the pin; nothing was read, so the writer can't be depending on this count
+            __atomic_fetch_sub(&reader_count, 1, __ATOMIC_RELAXED);
+        }
+    }
+
+    auto unpin(int_t slot_index) const noexcept -> void
+    {
+        [[maybe_unused]] auto const prior_count
+            = __atomic_fetch_sub(&slots_[slot_index].reader_count, 1, __ATOMIC_RELEASE);
+        assert(prior_count > 0 && "double_buffer_t: unpinned a slot that was not pinned");
+    }
+
+    // reader counts are written on every read, so each gets its own line, away from the read-mostly index
+    struct slot_t
+    {
+        alignas(64) mutable int_t reader_count = 0;
+        alignas(64) value_t value{};
+    };
+
+    alignas(64) int_t published_index_ = 0;
+    [[no_unique_address]] wait_t wait_{};
+    std::array<slot_t, 2> slots_{};
+};
+
+} // namespace crv
@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "double_buffer.hpp"
+#include <crv/test/test.hpp>
+#include <functional>
+#include <optional>
+
+namespace crv {
+namespace {
+
+struct double_buffer_test_t : Test
+{
+    using sut_t = double_buffer_t<int_t>;
+
+    sut_t sut{3};
+};
+
+TEST_F(double_buffer_test_t, initial_value_is_published)
+{
+    EXPECT_EQ(3, *sut.read());
+}
+
+TEST_F(double_buffer_test_t, read_visits_published_value)
+{
+    EXPECT_EQ(6, sut.read([](int_t value) { return 2 * value; }));
+}
+
+TEST_F(double_buffer_test_t, publish_replaces_value)
+{
+    sut.publish(5);
+    EXPECT_EQ(5, *sut.read());
+
+    sut.publish(7);
+    EXPECT_EQ(7, *sut.read());
+}
+
+TEST_F(double_buffer_test_t, staged_value_is_invisible_until_commit)
+{
+    sut.stage() = 5;
+    EXPECT_EQ(3, *sut.read());
+
+    sut.commit();
+    EXPECT_EQ(5, *sut.read());
+}
+
+TEST_F(double_buffer_test_t, restaging_returns_same_slot)
+{
+    auto& staged = sut.stage();
+    EXPECT_EQ(&staged, &sut.stage());
+}
+
+TEST_F(double_buffer_test_t, pinned_reader_keeps_its_value_across_commit)
+{
+    auto const guard = sut.read();
+
+    sut.publish(5);
+
+    EXPECT_EQ(3, *guard);
+    EXPECT_EQ(5, *sut.read());
+}
+
+// ====================================================================================================================
+// Writer Waits
+// ====================================================================================================================
+
+struct double_buffer_wait_test_t : Test
+{
+    // runs a callback on each wait so a single thread can play both writer and reader
+    struct wait_t
+    {
+        std::function<void()>* on_wait;
+
+        auto operator()() const -> void { (*on_wait)(); }
+    };
+
+    using sut_t = double_buffer_t<int_t, wait_t>;
+
+    std::function<void()> on_wait = [] { FAIL() << "writer waited"; };
+    sut_t sut{3, wait_t{&on_wait}};
+};
+
+TEST_F(double_buffer_wait_test_t, stage_waits_for_readers_of_unpublished_slot)
+{
+    // pin 3, then publish 5 over it; 3's slot is now unpublished, but still pinned
+    auto guard = std::optional<sut_t::read_guard_t>{};
+    guard.emplace(sut);
+    sut.publish(5);
+
+    auto wait_count = 0;
+    on_wait = [&] {
+        ++wait_count;
+        guard.reset();
+    };
+
+    sut.stage() = 7;
+
+    EXPECT_EQ(1, wait_count);
+    EXPECT_EQ(5, *sut.read());
+}
+
+TEST_F(double_buffer_wait_test_t, stage_ignores_readers_of_published_slot)
+{
+    auto const guard = sut.read();
+    sut.stage() = 5;
+    sut.commit();
+
+    EXPECT_EQ(5, *sut.read());
+}
+
+} // namespace
+} // namespace crv
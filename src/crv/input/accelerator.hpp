@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief scales relative mouse motion by a spline's gain at its speed
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/fixed/rsqrt.hpp>
+#include <crv/math/rounding_mode.hpp>
+#include <crv/math/shifter.hpp>
+
+namespace crv::input {
+
+/// relative motion in device counts, coalesced over one report
+struct motion_t
+{
+    int32_t x;
+    int32_t y;
+
+    constexpr auto operator==(motion_t const&) const noexcept -> bool = default;
+};
+
+/// scales each report's motion by the gain the spline gives at the report's speed
+///
+/// Speed is the length of the motion vector, in counts per report. It comes from multiplying the squared length by its
+/// reciprocal square root, so the whole path is fixed point, with no division, no allocation, and a fixed amount of
+/// work per report. Callers may instead evaluate the spline at their own velocity derived from speed, like one
+/// normalized by time.
+///
+/// Scaled components round to nearest, away from zero, so motion is symmetric in every direction. scale() skips the
+/// rounding, so callers can carry the fraction into the next report instead.
+template <typename t_spline_t, typename t_rsqrt_t = rsqrt_t<fixed_t<uint64_t, 62>, fixed_t<uint64_t, 0>>>
+class accelerator_t
+{
+public:
+    using spline_t = t_spline_t;
+    using rsqrt_t = t_rsqrt_t;
+    using x_t = spline_t::x_t;
+    using y_t = spline_t::y_t;
+    using length_squared_t = rsqrt_t::in_t;
+    using inverse_length_t = rsqrt_t::out_t;
+    using count_t = fixed_t<int64_t, 0>;
+    using out_t = fixed_t<int32_t, 0>;
+    using scaled_t = fixed::product_t<count_t, y_t>;
+
+    /// motion scaled by a gain, before rounding to whole counts
+    struct scaled_motion_t
+    {
+        scaled_t x;
+        scaled_t y;
+
+        constexpr auto operator==(scaled_motion_t const&) const noexcept -> bool = default;
+    };
+
+    // products are at most 94 bits, so biasing them can't overflow
+    static constexpr auto shifter = shifter_t<rounding_modes::shr::fast::nearest_away>{};
+
+    /// squared length of a motion and its reciprocal square root
+    ///
+    /// Speed and direction both follow from these, so stages that need either can share one rsqrt.
+    struct magnitude_t
+    {
+        length_squared_t length_squared;
+
+        /// 1/length; 0 for zero motion
+        inverse_length_t inverse_length;
+
+        constexpr auto operator==(magnitude_t const&) const noexcept -> bool = default;
+    };
+
+    /// \returns squared length of motion and its reciprocal square root
+    constexpr auto magnitude(motion_t motion) const noexcept -> magnitude_t
+    {
+        // each square fits in 62 bits, so their sum can't overflow 64
+        auto const x = int64_t{motion.x};
+        auto const y = int64_t{motion.y};
+        auto const length_squared
+            = length_squared_t::literal(static_cast<uint64_t>(x * x) + static_cast<uint64_t>(y * y));
+
+        // rsqrt is undefined at 0
+        if (!length_squared) return {};
+
+        return {length_squared, rsqrt_(length_squared)};
+    }
+
+    /// length of motion, saturated to the spline's domain
+    constexpr auto speed(motion_t motion) const noexcept -> x_t { return speed(magnitude(motion)); }
+
+    /// length of motion whose magnitude is known, saturated to the spline's domain
+    static constexpr auto speed(magnitude_t magnitude) noexcept -> x_t
+    {
+        return x_t::convert(multiply(magnitude.length_squared, magnitude.inverse_length));
+    }
+
+    /// \returns motion scaled by spline(speed(motion)), rounded to whole counts
+    constexpr auto operator()(motion_t motion, spline_t const& spline) const noexcept -> motion_t
+    {
+        auto const scaled = scale(motion, spline);
+        return {round(scaled.x), round(scaled.y)};
+    }
+
+    /// \returns motion scaled by spline(speed(motion)), unrounded
+    constexpr auto scale(motion_t motion, spline_t const& spline) const noexcept -> scaled_motion_t
+    {
+        if (motion == motion_t{}) [[unlikely]] return {};
+
+        return scale(motion, spline, speed(motion));
+    }
+
+    /// \returns motion scaled by spline(velocity), unrounded
+    constexpr auto scale(motion_t motion, spline_t const& spline, x_t velocity) const noexcept -> scaled_motion_t
+    {
+        return scale(motion, spline(velocity));
+    }
+
+    /// \returns motion scaled by a gain the caller evaluated, unrounded
+    static constexpr auto scale(motion_t motion, y_t gain) noexcept -> scaled_motion_t
+    {
+        return {multiply(count_t{motion.x}, gain), multiply(count_t{motion.y}, gain)};
+    }
+
+    /// \returns motion as if scaled by unit gain
+    static constexpr auto unscaled(motion_t motion) noexcept -> scaled_motion_t
+    {
+        return {scaled_t::convert(count_t{motion.x}), scaled_t::convert(count_t{motion.y})};
+    }
+
+private:
+    static constexpr auto round(scaled_t scaled) noexcept -> int32_t
+    {
+        return out_t::template convert<shifter>(scaled).value;
+    }
+
+    [[no_unique_address]] rsqrt_t rsqrt_{};
+};
+
+} // namespace crv::input
@@ -0,0 +1,110 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "accelerator.hpp"
+#include <crv/math/limits.hpp>
+#include <crv/test/test.hpp>
+
+namespace crv::input {
+namespace {
+
+using x_t = fixed_t<int64_t, 42>;
+using y_t = fixed_t<int64_t, 45>;
+
+/// gain is a constant plus a multiple of speed, so tests can check both the speed and the scaling
+struct spline_t
+{
+    using x_t = x_t;
+    using y_t = y_t;
+
+    y_t constant;
+    int64_t speed_divisor = 0;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t
+    {
+        if (!speed_divisor) return constant;
+        return y_t::literal(constant.value + (x.value << (y_t::frac_bits - x_t::frac_bits)) / speed_divisor);
+    }
+};
+
+using sut_t = accelerator_t<spline_t>;
+
+constexpr auto sut = sut_t{};
+
+// ====================================================================================================================
+// speed
+// ====================================================================================================================
+
+constexpr auto speed_near(motion_t motion, x_t expected) noexcept -> bool
+{
+    // rsqrt is accurate to a few ulps
+    constexpr auto tolerance = int64_t{1} << 8;
+    auto const error = sut.speed(motion).value - expected.value;
+    return -tolerance <= error && error <= tolerance;
+}
+
+static_assert(sut.speed({0, 0}) == x_t{0});
+static_assert(speed_near({1, 0}, x_t{1}));
+static_assert(speed_near({0, -1}, x_t{1}));
+static_assert(speed_near({3, 4}, x_t{5}));
+static_assert(speed_near({-3, 4}, x_t{5}));
+static_assert(speed_near({-300, -400}, x_t{500}));
+
+// speed past x_t's range saturates
+static_assert(sut.speed({min<int32_t>(), min<int32_t>()}) == max<x_t>());
+
+// magnitude carries what speed needs, so stages can share one rsqrt
+static_assert(sut.magnitude({0, 0}) == sut_t::magnitude_t{});
+static_assert(sut.magnitude({3, -4}).length_squared == sut_t::length_squared_t{25});
+static_assert(sut_t::speed(sut.magnitude({-300, -400})) == sut.speed({-300, -400}));
+
+// ====================================================================================================================
+// scaling
+// ====================================================================================================================
+
+// zero motion stays zero without evaluating the spline
+static_assert(sut({0, 0}, spline_t{.constant = y_t{5}}) == motion_t{0, 0});
+
+// unit gain is identity
+static_assert(sut({3, -4}, spline_t{.constant = y_t{1}}) == motion_t{3, -4});
+
+// constant gain
+static_assert(sut({3, -4}, spline_t{.constant = y_t{2}}) == motion_t{6, -8});
+
+// halves round away from zero, symmetrically
+static_assert(sut({3, -3}, spline_t{.constant = y_t::literal(1LL << 44)}) == motion_t{2, -2});
+static_assert(sut({1, -1}, spline_t{.constant = y_t::literal(1LL << 44)}) == motion_t{1, -1});
+
+// gain follows speed; speed 5 gives gain 2
+static_assert(sut({3, 4}, spline_t{.constant = y_t{1}, .speed_divisor = 5}) == motion_t{6, 8});
+static_assert(sut({-6, 8}, spline_t{.constant = y_t{1}, .speed_divisor = 5}) == motion_t{-18, 24});
+
+// scaled counts saturate
+static_assert(sut({max<int32_t>(), min<int32_t>()}, spline_t{.constant = y_t{4}})
+              == motion_t{max<int32_t>(), min<int32_t>()});
+
+// ====================================================================================================================
+// unrounded scaling
+// ====================================================================================================================
+
+using scaled_t = sut_t::scaled_t;
+using scaled_motion_t = sut_t::scaled_motion_t;
+
+// zero motion stays zero
+static_assert(sut.scale({0, 0}, spline_t{.constant = y_t{5}}) == scaled_motion_t{});
+
+// fractions are kept
+static_assert(sut.scale({3, -3}, spline_t{.constant = y_t::literal(1LL << 44)})
+              == scaled_motion_t{scaled_t::literal(3LL << 44), scaled_t::literal(-3LL << 44)});
+
+// velocity replaces speed; speed 5 would give gain 2, but velocity 10 gives gain 3
+static_assert(sut.scale({3, 4}, spline_t{.constant = y_t{1}, .speed_divisor = 5}, x_t{10})
+              == scaled_motion_t{scaled_t{9}, scaled_t{12}});
+
+// unscaled is unit gain
+static_assert(sut_t::unscaled({3, -4}) == sut.scale({3, -4}, spline_t{.constant = y_t{1}}));
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,154 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief fixed-capacity table of per-device state
+///
+/// This type is shared between the kernel module and user mode, so it uses compiler atomic builtins rather than
+/// std::atomic, and it never allocates.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <array>
+#include <cassert>
+
+namespace crv::input {
+
+/// per-device state for every attached source device
+///
+/// Slots are claimed by an opaque handle, like the kernel's input_handle, which identifies one connection to one
+/// device. Each slot also records its device's name, which is how model::device_t names devices, so configuration can
+/// be applied to every connected device with a given name.
+///
+/// Lookup by handle is lock-free. Handles are packed together, so a lookup scans a line or two of read-mostly memory.
+/// Values each get their own line, so devices reporting on different cpus never share one.
+///
+/// \pre attach(), detach(), and visit() are serialized by the caller
+template <typename t_value_t, int_t t_capacity> class device_table_t
+{
+public:
+    using value_t = t_value_t;
+    using handle_t = void const*;
+
+    static constexpr auto capacity = t_capacity;
+
+    /// names longer than this, including their terminator, are truncated
+    static constexpr auto name_capacity = int_t{64};
+
+    // ----------------------------------------------------------------------------------------------------------------
+    // Readers
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /// \returns handle's value, or nullptr if handle is not attached
+    auto find(handle_t handle) noexcept -> value_t*
+    {
+        for (auto index = 0; index < capacity; ++index)
+        {
+            if (__atomic_load_n(&handles_[index], __ATOMIC_ACQUIRE) == handle) return &slots_[index].value;
+        }
+        return nullptr;
+    }
+
+    /// \returns name recorded when value was attached
+    auto name(value_t const& value) const noexcept -> char const* { return slots_[index_of(value)].name.data(); }
+
+    /// \returns handle value was attached with
+    auto handle(value_t const& value) const noexcept -> handle_t { return handles_[index_of(value)]; }
+
+    // ----------------------------------------------------------------------------------------------------------------
+    // Writer
+    // ----------------------------------------------------------------------------------------------------------------
+
+    /// claims a free slot for handle and resets its value
+    ///
+    /// The value is fully written before the handle is published, so readers that find the handle see it initialized.
+    ///
+    /// \param name device name; may be nullptr
+    /// \returns handle's value, or nullptr if the table is full
+    auto attach(handle_t handle, char const* name) noexcept -> value_t*
+    {
+        assert(handle && "device_table_t: null handle");
+        assert(!find(handle) && "device_table_t: handle already attached");
+
+        for (auto index = 0; index < capacity; ++index)
+        {
+            if (handles_[index]) continue;
+
+            auto& slot = slots_[index];
+            slot.value = value_t{};
+            copy_name(slot.name, name);
+            __atomic_store_n(&handles_[index], handle, __ATOMIC_RELEASE);
+
+            return &slot.value;
+        }
+
+        return nullptr;
+    }
+
+    /// releases value's slot for reuse
+    ///
+    /// \pre no reader still uses value
+    auto detach(value_t const& value) noexcept -> void
+    {
+        __atomic_store_n(&handles_[index_of(value)], nullptr, __ATOMIC_RELEASE);
+    }
+
+    /// calls visitor with the value of every attached device named name
+    template <typename visitor_t> auto visit(char const* name, visitor_t&& visitor) noexcept -> void
+    {
+        for (auto index = 0; index < capacity; ++index)
+        {
+            if (handles_[index] && names_equal(slots_[index].name.data(), name)) visitor(slots_[index].value);
+        }
+    }
+
+private:
+    using name_t = std::array<char, name_capacity>;
+
+    struct slot_t
+    {
+        alignas(64) value_t value{};
+        name_t name{};
+    };
+
+    static constexpr auto copy_name(name_t& dst, char const* src) noexcept -> void
+    {
+        auto length = 0;
+        if (src)
+        {
+            for (; length < name_capacity - 1 && src[length]; ++length) dst[length] = src[length];
+        }
+        dst[length] = '\0';
+    }
+
+    /// compares a stored name to name, truncated the same way copy_name() truncates it
+    static constexpr auto names_equal(char const* stored, char const* name) noexcept -> bool
+    {
+        if (!name) name = "";
+        for (auto index = 0; index < name_capacity - 1; ++index)
+        {
+            if (stored[index] != name[index]) return false;
+            if (!stored[index]) return true;
+        }
+        return true;
+    }
+
+    auto index_of(value_t const& value) const noexcept -> int_t
+    {
+        for (auto index = 0; index < capacity; ++index)
+        {
+            if (&slots_[index].value == &value) return index;
+        }
+
+        assert(false && "device_table_t: value is not in this table");
+        return 0;
+    }
+
+    // written only on attach and detach, so readers on every cpu can keep these lines shared
+    alignas(64) std::array<handle_t, capacity> handles_{};
+    std::array<slot_t, capacity> slots_{};
+};
+
+} // namespace crv::input
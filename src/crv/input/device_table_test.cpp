@@ -0,0 +1,149 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "device_table.hpp"
+#include <crv/test/test.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace crv::input {
+namespace {
+
+struct device_table_test_t : Test
+{
+    struct value_t
+    {
+        int_t state = 0;
+    };
+
+    static constexpr auto capacity = 3;
+    using sut_t = device_table_t<value_t, capacity>;
+
+    int handles[capacity + 1]{};
+    sut_t sut{};
+};
+
+TEST_F(device_table_test_t, find_fails_when_empty)
+{
+    EXPECT_EQ(nullptr, sut.find(&handles[0]));
+}
+
+TEST_F(device_table_test_t, find_returns_attached_value)
+{
+    auto const first = sut.attach(&handles[0], "first");
+    auto const second = sut.attach(&handles[1], "second");
+
+    EXPECT_EQ(first, sut.find(&handles[0]));
+    EXPECT_EQ(second, sut.find(&handles[1]));
+    EXPECT_NE(first, second);
+}
+
+TEST_F(device_table_test_t, attach_fails_when_full)
+{
+    for (auto index = 0; index < capacity; ++index) ASSERT_NE(nullptr, sut.attach(&handles[index], "device"));
+
+    EXPECT_EQ(nullptr, sut.attach(&handles[capacity], "device"));
+    EXPECT_EQ(nullptr, sut.find(&handles[capacity]));
+}
+
+TEST_F(device_table_test_t, detach_frees_slot)
+{
+    for (auto index = 0; index < capacity; ++index) sut.attach(&handles[index], "device");
+
+    sut.detach(*sut.find(&handles[1]));
+
+    EXPECT_EQ(nullptr, sut.find(&handles[1]));
+    EXPECT_NE(nullptr, sut.attach(&handles[capacity], "device"));
+}
+
+TEST_F(device_table_test_t, attach_resets_reused_slot)
+{
+    auto const detached = sut.attach(&handles[0], "device");
+    detached->state = 3;
+    sut.detach(*detached);
+
+    auto const attached = sut.attach(&handles[1], "device");
+
+    ASSERT_EQ(detached, attached);
+    EXPECT_EQ(0, attached->state);
+}
+
+TEST_F(device_table_test_t, values_are_on_separate_cache_lines)
+{
+    auto const first = reinterpret_cast<std::uintptr_t>(sut.attach(&handles[0], "first"));
+    auto const second = reinterpret_cast<std::uintptr_t>(sut.attach(&handles[1], "second"));
+
+    EXPECT_EQ(0u, first % 64);
+    EXPECT_EQ(0u, second % 64);
+    EXPECT_NE(first / 64, second / 64);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Names
+// --------------------------------------------------------------------------------------------------------------------
+
+TEST_F(device_table_test_t, records_name)
+{
+    EXPECT_STREQ("device", sut.name(*sut.attach(&handles[0], "device")));
+}
+
+TEST_F(device_table_test_t, null_name_is_empty)
+{
+    EXPECT_STREQ("", sut.name(*sut.attach(&handles[0], nullptr)));
+}
+
+TEST_F(device_table_test_t, truncates_long_name)
+{
+    auto const name = std::string(sut_t::name_capacity * 2, 'n');
+
+    auto const value = sut.attach(&handles[0], name.c_str());
+
+    EXPECT_EQ(name.substr(0, sut_t::name_capacity - 1), sut.name(*value));
+}
+
+TEST_F(device_table_test_t, records_handle)
+{
+    sut.attach(&handles[0], "first");
+    auto const value = sut.attach(&handles[1], "second");
+
+    EXPECT_EQ(static_cast<void const*>(&handles[1]), sut.handle(*value));
+}
+
+TEST_F(device_table_test_t, visit_finds_attached_values_by_name)
+{
+    auto const first = sut.attach(&handles[0], "mouse");
+    sut.attach(&handles[1], "trackball");
+    auto const third = sut.attach(&handles[2], "mouse");
+
+    auto visited = std::vector<value_t*>{};
+    sut.visit("mouse", [&](value_t& value) { visited.push_back(&value); });
+
+    EXPECT_EQ((std::vector{first, third}), visited);
+}
+
+TEST_F(device_table_test_t, visit_skips_detached_values)
+{
+    sut.detach(*sut.attach(&handles[0], "mouse"));
+
+    auto visit_count = 0;
+    sut.visit("mouse", [&](value_t&) { ++visit_count; });
+
+    EXPECT_EQ(0, visit_count);
+}
+
+TEST_F(device_table_test_t, visit_matches_truncated_names)
+{
+    auto const name = std::string(sut_t::name_capacity * 2, 'n');
+    sut.attach(&handles[0], name.c_str());
+
+    auto visit_count = 0;
+    sut.visit(name.c_str(), [&](value_t&) { ++visit_count; });
+
+    EXPECT_EQ(1, visit_count);
+}
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,50 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief ioctl protocol of the kernel module's character device
+///
+/// The config tool uploads a spline without passing it through a syscall. It mmaps the device to get a staging buffer
+/// of crv_spline_payload_size() bytes, writes a spline_t::payload_t directly into it, then issues CRV_IOCTL_COMMIT.
+/// Each open file has its own staging buffer, so concurrent config tools can't interleave writes.
+///
+/// Per-source settings are small, so they go through CRV_IOCTL_CONFIGURE directly, addressed by device name.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/input/pipeline.h>
+#include <linux/ioctl.h>
+
+/// type byte shared by every request on the device
+#define CRV_IOCTL_TYPE 0xcb
+
+/// validates the payload in the file's staging buffer, then publishes it as the active spline
+///
+/// The argument is the size of the payload the caller wrote. It must match the module's, so a config tool built
+/// against a different payload layout is rejected rather than misread.
+///
+/// \returns 0 if the payload was published; fails with EINVAL if it was invalid, leaving the active spline unchanged
+#define CRV_IOCTL_COMMIT _IO(CRV_IOCTL_TYPE, 0x01)
+
+/// device names in crv_configure_request hold this many chars, including their terminator; longer names are truncated
+#define CRV_DEVICE_NAME_CAPACITY 64
+
+/// argument to CRV_IOCTL_CONFIGURE
+struct crv_configure_request
+{
+    /// name of the devices to configure, as the input core reports it; need not be terminated
+    char name[CRV_DEVICE_NAME_CAPACITY];
+
+    /// settings to apply to every connected device with that name
+    struct crv_source_config config;
+};
+
+/// replaces the configuration of every connected source device with the request's name
+///
+/// The argument points to a crv_configure_request. Each source's settings are replaced under its device's event lock,
+/// so no report sees some settings from before and some from after. Devices that connect later start unconfigured, so
+/// the config tool reapplies their settings when they do.
+///
+/// \returns 0, even if no device matched; fails with EFAULT if the request can't be read
+#define CRV_IOCTL_CONFIGURE _IOW(CRV_IOCTL_TYPE, 0x02, struct crv_configure_request)
@@ -0,0 +1,33 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "latency.hpp"
+
+#if defined CRV_ENABLE_LATENCY_HISTOGRAMS
+
+extern "C" auto crv_latency_now() -> unsigned long long
+{
+#if defined __x86_64__ || defined __i386__
+    return __builtin_ia32_rdtsc();
+#else
+    return 0;
+#endif
+}
+
+extern "C" auto crv_latency_record(crv_latency_stage stage, unsigned long long start_cycles) -> void
+{
+    using namespace crv::input;
+
+    auto const cycles = crv_latency_now() - start_cycles;
+    auto& latency = *crv_latency_local();
+    auto& count = latency.counts[stage][latency_bucket(cycles)];
+    auto& total = latency.cycles[stage];
+
+    // only this cpu writes its histograms, but readers sum them while it does, so the stores must not tear
+    __atomic_store_n(&count, count + 1, __ATOMIC_RELAXED);
+    __atomic_store_n(&total, total + cycles, __ATOMIC_RELAXED);
+}
+
+#endif
@@ -0,0 +1,98 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief per-cpu cycle histograms of the input handler's hot path
+///
+/// Histograms only exist when CRV_ENABLE_LATENCY_HISTOGRAMS is defined. Otherwise, the probes compile to nothing, so
+/// production builds pay nothing for them.
+///
+/// Each cpu records into its own histograms, so recording never contends or locks. Readers sum them across cpus.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+/// stages of the hot path, in the order a report passes through them
+///
+/// CRV_LATENCY_REPORT spans every stage from CRV_LATENCY_DELTA through CRV_LATENCY_CARRY, plus the timer reads of those
+/// stages' probes.
+enum crv_latency_stage
+{
+    /// coalescing one REL_X or REL_Y event into its source's pending report
+    CRV_LATENCY_FILTER,
+
+    /// ending a report, from pending motion to the motion to emit
+    CRV_LATENCY_REPORT,
+
+    /// taking a report's pending motion, and dropping state left from a previous motion
+    CRV_LATENCY_DELTA,
+
+    /// mapping a report's motion through its source's transform, carrying what rounding drops
+    CRV_LATENCY_TRANSFORM,
+
+    /// measuring a report's length, via rsqrt
+    CRV_LATENCY_LENGTH,
+
+    /// snapping a report's motion to the notch
+    CRV_LATENCY_NOTCH,
+
+    /// measuring and smoothing a report's velocity
+    CRV_LATENCY_VELOCITY,
+
+    /// finding the spline segment at a report's velocity
+    CRV_LATENCY_LOCATE,
+
+    /// evaluating the spline in that segment
+    CRV_LATENCY_EVALUATE,
+
+    /// scaling a report's motion by the spline's output
+    CRV_LATENCY_SCALE,
+
+    /// rounding scaled motion to whole counts, carrying what rounding drops
+    CRV_LATENCY_CARRY,
+
+    /// reporting scaled motion from the output device
+    CRV_LATENCY_EMIT,
+
+    CRV_LATENCY_STAGE_COUNT
+};
+
+/// buckets in each stage's histogram; see crv::input::latency_bucket()
+#define CRV_LATENCY_BUCKET_COUNT 128
+
+/// one cpu's histograms, counting events per bucket of elapsed cycles
+struct crv_latency
+{
+    unsigned long long counts[CRV_LATENCY_STAGE_COUNT][CRV_LATENCY_BUCKET_COUNT];
+
+    /// total elapsed cycles per stage, so means are exact rather than bucketed
+    unsigned long long cycles[CRV_LATENCY_STAGE_COUNT];
+};
+
+/// \returns current cpu's histograms
+///
+/// The platform defines this: the kernel module keeps one per cpu, and user mode keeps a single instance.
+///
+/// \pre preemption is disabled
+struct crv_latency* crv_latency_local(void);
+
+/// \returns current cycle count
+unsigned long long crv_latency_now(void);
+
+/// counts the cycles elapsed since start_cycles in the current cpu's histogram for stage
+///
+/// \pre preemption is disabled
+void crv_latency_record(enum crv_latency_stage stage, unsigned long long start_cycles);
+
+/// declares start_cycles for CRV_LATENCY_START() and CRV_LATENCY_STOP(), with the block's other declarations
+///
+/// This declares a variable either way, so c callers can keep declarations before statements.
+#define CRV_LATENCY_DECLARE(start_cycles) unsigned long long start_cycles __attribute__((unused))
+
+#ifdef CRV_ENABLE_LATENCY_HISTOGRAMS
+#define CRV_LATENCY_START(start_cycles) ((start_cycles) = crv_latency_now())
+#define CRV_LATENCY_STOP(stage, start_cycles) crv_latency_record(stage, start_cycles)
+#else
+#define CRV_LATENCY_START(start_cycles) do {} while (0)
+#define CRV_LATENCY_STOP(stage, start_cycles) do {} while (0)
+#endif
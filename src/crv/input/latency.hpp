@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief log-bucketed cycle histograms of the input pipeline's stages
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+extern "C" {
+#include <crv/input/latency.h>
+} // extern "C"
+
+#include <crv/lib.hpp>
+#include <crv/algorithm.hpp>
+#include <bit>
+
+namespace crv::input {
+
+/// each power of two is split into this many buckets
+inline constexpr auto latency_sub_bucket_bits = 2;
+inline constexpr auto latency_sub_bucket_count = int_t{1} << latency_sub_bucket_bits;
+
+/// maps a cycle count to its histogram bucket
+///
+/// Buckets are log-linear. Counts below latency_sub_bucket_count get a bucket apiece, and each power of two above is
+/// split into latency_sub_bucket_count equal buckets, so every bucket's floor is within 25% of the counts it holds.
+/// With 128 buckets, counts below 2^33 cycles are resolved, and the last bucket takes everything longer.
+constexpr auto latency_bucket(uint64_t cycles) noexcept -> int_t
+{
+    if (cycles < latency_sub_bucket_count) return static_cast<int_t>(cycles);
+
+    auto const octave = static_cast<int>(std::bit_width(cycles)) - 1;
+    auto const sub_bucket = static_cast<int_t>(cycles >> (octave - latency_sub_bucket_bits)) - latency_sub_bucket_count;
+    auto const bucket = (octave - latency_sub_bucket_bits + 1) * latency_sub_bucket_count + sub_bucket;
+
+    return min(bucket, int_t{CRV_LATENCY_BUCKET_COUNT - 1});
+}
+
+/// \returns smallest cycle count in bucket
+constexpr auto latency_bucket_floor(int_t bucket) noexcept -> uint64_t
+{
+    if (bucket < latency_sub_bucket_count) return static_cast<uint64_t>(bucket);
+
+    auto const octave = bucket / latency_sub_bucket_count + latency_sub_bucket_bits - 1;
+    auto const sub_bucket = static_cast<uint64_t>(bucket % latency_sub_bucket_count + latency_sub_bucket_count);
+
+    return sub_bucket << (octave - latency_sub_bucket_bits);
+}
+
+/// calls callable, counting the cycles it takes in stage's histogram on the current cpu
+///
+/// With histograms compiled out, this just calls callable.
+///
+/// \pre preemption is disabled
+template <typename callable_t> auto probe(crv_latency_stage stage, callable_t&& callable) noexcept -> decltype(auto)
+{
+#if defined CRV_ENABLE_LATENCY_HISTOGRAMS
+    auto const start_cycles = crv_latency_now();
+    auto const result = callable();
+    crv_latency_record(stage, start_cycles);
+    return result;
+#else
+    static_cast<void>(stage);
+    return callable();
+#endif
+}
+
+} // namespace crv::input
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief user-mode definition of crv_latency_local()
+///
+/// The kernel module defines its own, per cpu. User mode replays traces on one thread, so one instance suffices.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "latency.hpp"
+
+#if defined CRV_ENABLE_LATENCY_HISTOGRAMS
+
+namespace {
+
+constinit auto latency = crv_latency{};
+
+} // namespace
+
+extern "C" auto crv_latency_local() -> crv_latency*
+{
+    return &latency;
+}
+
+#endif
@@ -0,0 +1,88 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "latency_report.hpp"
+#include <crv/input/latency.hpp>
+#include <iterator>
+#include <sstream>
+
+namespace crv::input {
+namespace {
+
+// must match the module's names; see kernel/input/latency.c
+constexpr char const* latency_stage_names[] = {
+    "filter", "report", "delta", "transform", "length", "notch",
+    "velocity", "locate", "evaluate", "scale", "carry", "emit",
+};
+static_assert(std::size(latency_stage_names) == CRV_LATENCY_STAGE_COUNT);
+
+} // namespace
+
+auto latency_stage_t::mean() const noexcept -> float_t
+{
+    auto const count = histogram.count();
+    return count ? static_cast<float_t>(cycles) / static_cast<float_t>(count) : 0.0;
+}
+
+auto operator<<(std::ostream& out, latency_stage_t const& src) -> std::ostream&
+{
+    return out << src.name << ": " << src.histogram.count() << " events, mean = " << src.mean() << ", "
+               << src.percentiles() << " cycles";
+}
+
+auto parse_latency(std::istream& in) -> std::optional<std::vector<latency_stage_t>>
+{
+    auto result = std::vector<latency_stage_t>{};
+
+    auto line = std::string{};
+    while (std::getline(in, line))
+    {
+        if (line.empty()) continue;
+
+        auto fields = std::istringstream{line};
+        auto stage = latency_stage_t{};
+        if (!(fields >> stage.name >> stage.cycles) || stage.cycles < 0) return std::nullopt;
+
+        auto buckets = latency_stage_t::histogram_t::map_t{};
+        for (auto bucket = 0; bucket < CRV_LATENCY_BUCKET_COUNT; ++bucket)
+        {
+            auto count = int_t{};
+            if (!(fields >> count) || count < 0) return std::nullopt;
+            if (count) buckets[static_cast<int_t>(latency_bucket_floor(bucket))] = count;
+        }
+
+        // nothing may follow the last bucket
+        auto extra = std::string{};
+        if (fields >> extra) return std::nullopt;
+
+        stage.histogram = latency_stage_t::histogram_t{std::move(buckets)};
+        result.push_back(std::move(stage));
+    }
+
+    return result;
+}
+
+auto latency_stages(crv_latency const& latency) -> std::vector<latency_stage_t>
+{
+    auto result = std::vector<latency_stage_t>{};
+    result.reserve(CRV_LATENCY_STAGE_COUNT);
+
+    for (auto stage = 0; stage < CRV_LATENCY_STAGE_COUNT; ++stage)
+    {
+        auto buckets = latency_stage_t::histogram_t::map_t{};
+        for (auto bucket = 0; bucket < CRV_LATENCY_BUCKET_COUNT; ++bucket)
+        {
+            auto const count = static_cast<int_t>(latency.counts[stage][bucket]);
+            if (count) buckets[static_cast<int_t>(latency_bucket_floor(bucket))] = count;
+        }
+
+        result.push_back({latency_stage_names[stage], static_cast<int_t>(latency.cycles[stage]),
+            latency_stage_t::histogram_t{std::move(buckets)}});
+    }
+
+    return result;
+}
+
+} // namespace crv::input
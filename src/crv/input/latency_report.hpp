@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief reads latency histograms, the kernel module's or this process's, in user mode
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/input/latency.hpp>
+#include <crv/math/stats.hpp>
+#include <istream>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace crv::input {
+
+/// one stage's histogram, keyed by each bucket's floor in cycles
+struct latency_stage_t
+{
+    using histogram_t = crv::histogram_t<int_t>;
+    using percentiles_t = percentile_calculator_t<int_t>::result_t;
+
+    std::string name;
+
+    /// total elapsed cycles over every event
+    int_t cycles{};
+
+    histogram_t histogram;
+
+    /// \returns mean cycles per event, exact rather than bucketed, or 0 without events
+    auto mean() const noexcept -> float_t;
+
+    /// \returns percentiles in cycles; each is the floor of the bucket it falls in, so within 25% of the true value
+    auto percentiles() const noexcept -> percentiles_t { return percentile_calculator_t<int_t>{}(histogram); }
+
+    /// prints name, event count, mean, and percentiles on one line
+    friend auto operator<<(std::ostream& out, latency_stage_t const& src) -> std::ostream&;
+};
+
+/// parses the module's debugfs latency file
+///
+/// Each line is a stage name, its total cycles, then its count in each of CRV_LATENCY_BUCKET_COUNT buckets.
+///
+/// \returns each stage, in file order, or nullopt if a line is malformed
+auto parse_latency(std::istream& in) -> std::optional<std::vector<latency_stage_t>>;
+
+/// converts histograms recorded in this process, like a user-mode benchmark's, to the stages the module exports
+///
+/// \returns each stage, named as in the module's debugfs file, in crv_latency_stage order
+auto latency_stages(crv_latency const& latency) -> std::vector<latency_stage_t>;
+
+} // namespace crv::input
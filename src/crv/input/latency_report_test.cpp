@@ -0,0 +1,142 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "latency_report.hpp"
+#include <crv/input/latency.hpp>
+#include <crv/test/test.hpp>
+#include <sstream>
+
+namespace crv::input {
+namespace {
+
+/// formats one line the way the module's debugfs file does
+auto line(std::string_view name, std::map<int_t, int_t> const& counts, int_t cycles = 0) -> std::string
+{
+    auto result = std::ostringstream{};
+    result << name << " " << cycles;
+    for (auto bucket = 0; bucket < CRV_LATENCY_BUCKET_COUNT; ++bucket)
+    {
+        auto const count = counts.find(bucket);
+        result << " " << (count == counts.end() ? 0 : count->second);
+    }
+    result << "\n";
+    return result.str();
+}
+
+auto parse(std::string const& text) -> std::optional<std::vector<latency_stage_t>>
+{
+    auto in = std::istringstream{text};
+    return parse_latency(in);
+}
+
+TEST(latency_report_test, parses_stages_in_order)
+{
+    auto const actual = parse(line("filter", {}) + line("locate", {{4, 1}}));
+
+    ASSERT_TRUE(actual);
+    ASSERT_EQ(2, std::ssize(*actual));
+    EXPECT_EQ("filter", (*actual)[0].name);
+    EXPECT_EQ(0, (*actual)[0].histogram.count());
+    EXPECT_EQ("locate", (*actual)[1].name);
+    EXPECT_EQ(1, (*actual)[1].histogram.count());
+}
+
+TEST(latency_report_test, keys_buckets_by_floor)
+{
+    auto const actual = parse(line("evaluate", {{11, 2}, {22, 3}}));
+
+    ASSERT_TRUE(actual);
+    EXPECT_EQ((latency_stage_t::histogram_t{{{14, 2}, {96, 3}}}), (*actual)[0].histogram);
+}
+
+TEST(latency_report_test, reports_percentiles_in_cycles)
+{
+    // 98 fast events at 96 cycles, then 1 at 2^10 and 1 at 2^12
+    auto const actual = parse(line("emit", {{22, 98}, {latency_bucket(1 << 10), 1}, {latency_bucket(1 << 12), 1}}));
+
+    ASSERT_TRUE(actual);
+    auto const percentiles = (*actual)[0].percentiles();
+    EXPECT_EQ(96, percentiles.p50);
+    EXPECT_EQ(1 << 10, percentiles.p99);
+    EXPECT_EQ(1 << 12, percentiles.p100);
+}
+
+TEST(latency_report_test, reports_exact_mean)
+{
+    // 3 events in the bucket with floor 96, totalling 300 cycles
+    auto const actual = parse(line("scale", {{22, 3}}, 300));
+
+    ASSERT_TRUE(actual);
+    EXPECT_EQ(300, (*actual)[0].cycles);
+    EXPECT_EQ(100.0, (*actual)[0].mean());
+}
+
+TEST(latency_report_test, mean_without_events_is_zero)
+{
+    auto const actual = parse(line("carry", {}));
+
+    ASSERT_TRUE(actual);
+    EXPECT_EQ(0.0, (*actual)[0].mean());
+}
+
+TEST(latency_report_test, skips_blank_lines)
+{
+    auto const actual = parse("\n" + line("filter", {}) + "\n");
+
+    ASSERT_TRUE(actual);
+    EXPECT_EQ(1, std::ssize(*actual));
+}
+
+TEST(latency_report_test, rejects_missing_cycles)
+{
+    EXPECT_FALSE(parse("filter\n"));
+}
+
+TEST(latency_report_test, rejects_negative_cycles)
+{
+    EXPECT_FALSE(parse(line("filter", {}, -1)));
+}
+
+TEST(latency_report_test, rejects_missing_buckets)
+{
+    EXPECT_FALSE(parse("filter 0 1 2 3\n"));
+}
+
+TEST(latency_report_test, rejects_extra_buckets)
+{
+    auto text = line("filter", {});
+    text.insert(text.size() - 1, " 7");
+
+    EXPECT_FALSE(parse(text));
+}
+
+TEST(latency_report_test, rejects_negative_counts)
+{
+    EXPECT_FALSE(parse(line("filter", {{3, -1}})));
+}
+
+TEST(latency_report_test, converts_local_histograms_to_named_stages)
+{
+    auto latency = crv_latency{};
+    latency.counts[CRV_LATENCY_REPORT][11] = 2;
+    latency.cycles[CRV_LATENCY_REPORT] = 30;
+    latency.counts[CRV_LATENCY_EMIT][22] = 3;
+
+    auto const actual = latency_stages(latency);
+
+    ASSERT_EQ(CRV_LATENCY_STAGE_COUNT, std::ssize(actual));
+    EXPECT_EQ("filter", actual[CRV_LATENCY_FILTER].name);
+    EXPECT_EQ(0, actual[CRV_LATENCY_FILTER].histogram.count());
+    EXPECT_EQ("report", actual[CRV_LATENCY_REPORT].name);
+    EXPECT_EQ(30, actual[CRV_LATENCY_REPORT].cycles);
+    EXPECT_EQ((latency_stage_t::histogram_t{{{14, 2}}}), actual[CRV_LATENCY_REPORT].histogram);
+    EXPECT_EQ("length", actual[CRV_LATENCY_LENGTH].name);
+    EXPECT_EQ("carry", actual[CRV_LATENCY_CARRY].name);
+    EXPECT_EQ("emit", actual[CRV_LATENCY_EMIT].name);
+    EXPECT_EQ((latency_stage_t::histogram_t{{{96, 3}}}), actual[CRV_LATENCY_EMIT].histogram);
+}
+
+} // namespace
+} // namespace crv::input
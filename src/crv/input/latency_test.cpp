@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "latency.hpp"
+#include <crv/math/limits.hpp>
+#include <crv/test/test.hpp>
+#include <iterator>
+#include <numeric>
+
+namespace crv::input {
+namespace {
+
+// small counts get a bucket apiece
+static_assert(latency_bucket(0) == 0);
+static_assert(latency_bucket(3) == 3);
+
+// then each power of two splits in four
+static_assert(latency_bucket(4) == 4);
+static_assert(latency_bucket(7) == 7);
+static_assert(latency_bucket(8) == 8);
+static_assert(latency_bucket(9) == 8);
+static_assert(latency_bucket(10) == 9);
+static_assert(latency_bucket(15) == 11);
+static_assert(latency_bucket(16) == 12);
+static_assert(latency_bucket(100) == 22);
+
+// the last bucket takes everything past 2^33
+static_assert(latency_bucket((uint64_t{1} << 33) - 1) == CRV_LATENCY_BUCKET_COUNT - 1);
+static_assert(latency_bucket(uint64_t{1} << 33) == CRV_LATENCY_BUCKET_COUNT - 1);
+static_assert(latency_bucket(max<uint64_t>()) == CRV_LATENCY_BUCKET_COUNT - 1);
+
+static_assert(latency_bucket_floor(11) == 14);
+static_assert(latency_bucket_floor(22) == 96);
+
+TEST(latency_test, floors_are_the_first_count_in_each_bucket)
+{
+    for (auto bucket = 0; bucket < CRV_LATENCY_BUCKET_COUNT; ++bucket)
+    {
+        auto const floor = latency_bucket_floor(bucket);
+        EXPECT_EQ(bucket, latency_bucket(floor)) << "bucket " << bucket;
+        if (floor) EXPECT_EQ(bucket - 1, latency_bucket(floor - 1)) << "bucket " << bucket;
+    }
+}
+
+TEST(latency_test, floors_are_within_a_quarter)
+{
+    for (auto bucket = latency_sub_bucket_count; bucket < CRV_LATENCY_BUCKET_COUNT - 1; ++bucket)
+    {
+        auto const floor = latency_bucket_floor(bucket);
+        auto const width = latency_bucket_floor(bucket + 1) - floor;
+        EXPECT_LE(4 * width, floor) << "bucket " << bucket;
+    }
+}
+
+TEST(latency_test, probe_returns_callable_result)
+{
+    EXPECT_EQ(3, probe(CRV_LATENCY_LOCATE, [] { return 3; }));
+}
+
+#if defined CRV_ENABLE_LATENCY_HISTOGRAMS
+
+TEST(latency_test, probe_counts_one_event_in_stage)
+{
+    auto const& counts = crv_latency_local()->counts;
+    auto const total = [&](crv_latency_stage stage) {
+        return std::accumulate(std::begin(counts[stage]), std::end(counts[stage]), 0ull);
+    };
+    auto const evaluate_before = total(CRV_LATENCY_EVALUATE);
+    auto const emit_before = total(CRV_LATENCY_EMIT);
+
+    probe(CRV_LATENCY_EVALUATE, [] { return 0; });
+
+    EXPECT_EQ(evaluate_before + 1, total(CRV_LATENCY_EVALUATE));
+    EXPECT_EQ(emit_before, total(CRV_LATENCY_EMIT));
+}
+
+#endif
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,66 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief snaps motion near horizontal or vertical onto the axis
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/input/accelerator.hpp>
+#include <crv/math/abs.hpp>
+#include <crv/math/fixed/fixed.hpp>
+
+namespace crv::input {
+
+/// drops the minor component of motion that is nearly along an axis
+///
+/// Hands rarely move a mouse exactly along an axis, so strokes meant to be horizontal or vertical wander a count or two
+/// off of it. Within the notch, the smaller component is dropped, so they don't.
+///
+/// The notch is measured by the sine of the angle to the nearest axis, |minor|/length. That needs 1/length, which the
+/// accelerator already computes for speed, so the notch takes it from accelerator_t::magnitude() rather than taking
+/// another rsqrt. Each report then costs one multiply, one compare, and two selects.
+///
+/// A threshold of 0 disables the notch. A threshold of sin(45 degrees) or more snaps all motion to its nearest axis.
+class notch_t
+{
+public:
+    /// sine of the notch's half width, in [0, 1]; q62 matches rsqrt's output, so comparing needs no shift
+    using threshold_t = fixed_t<uint64_t, 62>;
+
+    /// \returns threshold currently applied
+    auto threshold() const noexcept -> threshold_t { return threshold_; }
+
+    /// sets the threshold; 0 disables the notch, which is the default
+    ///
+    /// This must not race operator(); see crv_source_configure().
+    auto threshold(threshold_t threshold) noexcept -> void { threshold_ = threshold; }
+
+    /// \returns motion, with its minor component dropped if it is within the notch
+    /// \param inverse_length 1/length of motion, or 0 if motion is zero
+    template <is_fixed inverse_length_t>
+    auto operator()(motion_t motion, inverse_length_t inverse_length) const noexcept -> motion_t
+    {
+        using count_t = fixed_t<uint64_t, 0>;
+
+        // widened first; negating min<int32_t>() is unrepresentable
+        auto const x = static_cast<uint64_t>(abs(int64_t{motion.x}));
+        auto const y = static_cast<uint64_t>(abs(int64_t{motion.y}));
+
+        // on the diagonal, y is dropped, as is any tie
+        auto const x_is_minor = x < y;
+        auto const minor = count_t{x_is_minor ? x : y};
+
+        // |minor| <= length, so the sine fits
+        auto const sin = threshold_t::convert(multiply(minor, inverse_length));
+        auto const snap = sin < threshold();
+
+        return {snap && x_is_minor ? 0 : motion.x, snap && !x_is_minor ? 0 : motion.y};
+    }
+
+private:
+    threshold_t threshold_{};
+};
+
+} // namespace crv::input
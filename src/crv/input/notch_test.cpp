@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "notch.hpp"
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/test/test.hpp>
+#include <cmath>
+
+namespace crv::input {
+namespace {
+
+using threshold_t = notch_t::threshold_t;
+using inverse_length_t = fixed_t<uint64_t, 62>;
+
+constexpr auto quarter = threshold_t::literal(1ULL << 60);
+constexpr auto half = threshold_t::literal(1ULL << 61);
+
+auto inverse_length(motion_t motion) -> inverse_length_t
+{
+    return to_fixed<inverse_length_t>(1 / std::hypot(float_t(motion.x), float_t(motion.y)));
+}
+
+struct notch_test_t : Test
+{
+    notch_t sut{};
+
+    auto snap(motion_t motion) const noexcept -> motion_t { return sut(motion, inverse_length(motion)); }
+};
+
+TEST_F(notch_test_t, defaults_to_disabled)
+{
+    EXPECT_EQ(threshold_t{}, sut.threshold());
+    EXPECT_EQ((motion_t{100, 1}), snap(motion_t{100, 1}));
+}
+
+TEST_F(notch_test_t, threshold_round_trips)
+{
+    sut.threshold(quarter);
+
+    EXPECT_EQ(quarter, sut.threshold());
+}
+
+TEST_F(notch_test_t, drops_minor_y_within_notch)
+{
+    sut.threshold(quarter);
+
+    EXPECT_EQ((motion_t{10, 0}), snap(motion_t{10, 1}));
+    EXPECT_EQ((motion_t{-10, 0}), snap(motion_t{-10, -2}));
+}
+
+TEST_F(notch_test_t, drops_minor_x_within_notch)
+{
+    sut.threshold(quarter);
+
+    EXPECT_EQ((motion_t{0, 10}), snap(motion_t{1, 10}));
+    EXPECT_EQ((motion_t{0, -10}), snap(motion_t{-2, -10}));
+}
+
+TEST_F(notch_test_t, keeps_motion_outside_notch)
+{
+    sut.threshold(quarter);
+
+    // sines are 0.6 and 0.8
+    EXPECT_EQ((motion_t{4, 3}), snap(motion_t{4, 3}));
+    EXPECT_EQ((motion_t{-3, 4}), snap(motion_t{-3, 4}));
+}
+
+TEST_F(notch_test_t, keeps_motion_on_threshold)
+{
+    // (1, 1)/2 has a sine of exactly 1/2, given an exact inverse length
+    auto const inverse_length = inverse_length_t::literal(1ULL << 61);
+
+    sut.threshold(half);
+    EXPECT_EQ((motion_t{1, 1}), sut(motion_t{1, 1}, inverse_length));
+
+    sut.threshold(threshold_t::literal(half.value + 1));
+    EXPECT_EQ((motion_t{1, 0}), sut(motion_t{1, 1}, inverse_length));
+}
+
+TEST_F(notch_test_t, keeps_axis_and_zero_motion)
+{
+    sut.threshold(quarter);
+
+    EXPECT_EQ((motion_t{0, 0}), sut(motion_t{0, 0}, inverse_length_t{}));
+    EXPECT_EQ((motion_t{7, 0}), snap(motion_t{7, 0}));
+    EXPECT_EQ((motion_t{0, -7}), snap(motion_t{0, -7}));
+}
+
+} // namespace
+} // namespace crv::input
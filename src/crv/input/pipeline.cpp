@@ -0,0 +1,178 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "pipeline.hpp"
+#include <crv/input/latency.hpp>
+#include <crv/math/saturate_cast.hpp>
+
+namespace crv::input {
+namespace {
+
+// constant initialized, so the kernel needs no static constructors
+constinit auto active_spline_instance = active_spline_t{};
+constinit auto source_table_instance = source_table_t{};
+
+/// maps motion through the source's transform, carrying what rounding drops
+auto transform(crv_source& source, motion_t motion) noexcept -> motion_t
+{
+    auto const transformed = source.transform.scale(motion);
+    auto const x = source.transform_remainder_x(transformed.x);
+    auto const y = source.transform_remainder_y(transformed.y);
+    return motion_t{x.value, y.value};
+}
+
+/// scales motion by the source's spline at the velocity speed gives
+auto scale(crv_source& source, int64_t time_us, motion_t motion, prod_accelerator_t::x_t speed) noexcept
+    -> prod_accelerator_t::scaled_motion_t
+{
+    // measured even without a spline, so the first report after publishing has a real interval
+    auto const velocity = probe(CRV_LATENCY_VELOCITY, [&] {
+        auto const measured = source.velocity(time_us, speed);
+        return source.smoother(measured, source.velocity.interval_us());
+    });
+
+    return source.spline->read([&](spline::prod_spline_t const& spline) noexcept {
+        if (spline.payload.segment_locator.segment_count() == 0) [[unlikely]]
+        {
+            return prod_accelerator_t::unscaled(motion);
+        }
+
+        // operator() in halves, so each can be timed
+        auto& cursor = source.spline_cursor;
+        auto const location = probe(CRV_LATENCY_LOCATE, [&] { return spline.locate_segment(velocity, cursor); });
+        auto const gain
+            = probe(CRV_LATENCY_EVALUATE, [&] { return spline.evaluate_segment(location, velocity, cursor); });
+
+        return probe(CRV_LATENCY_SCALE, [&] { return prod_accelerator_t::scale(motion, gain); });
+    });
+}
+
+} // namespace
+
+auto active_spline() noexcept -> active_spline_t&
+{
+    return active_spline_instance;
+}
+
+auto source_table() noexcept -> source_table_t&
+{
+    return source_table_instance;
+}
+
+} // namespace crv::input
+
+extern "C" auto crv_spline_payload_size() -> unsigned long
+{
+    return sizeof(crv::spline::prod_spline_t::payload_t);
+}
+
+extern "C" auto crv_spline_commit(void const* staging, unsigned long size) -> int
+{
+    using namespace crv::input;
+    using payload_t = crv::spline::prod_spline_t::payload_t;
+
+    // a config tool built against a different layout would be misread
+    if (size != sizeof(payload_t)) return 0;
+
+    // staging may still be writable by user space, so only the private copy is validated and published
+    auto& staged = active_spline().stage();
+    staged.reset(*static_cast<payload_t const*>(staging));
+    if (!staged.is_valid()) return 0;
+
+    active_spline().commit();
+    return 1;
+}
+
+extern "C" auto crv_source_attach(void const* handle, char const* name) -> crv_source*
+{
+    using namespace crv::input;
+
+    auto const source = source_table().attach(handle, name);
+    if (source) source->spline = &active_spline();
+    return source;
+}
+
+extern "C" auto crv_source_detach(crv_source* source) -> void
+{
+    crv::input::source_table().detach(*source);
+}
+
+extern "C" auto crv_source_find(void const* handle) -> crv_source*
+{
+    return crv::input::source_table().find(handle);
+}
+
+extern "C" auto crv_source_visit(char const* name, crv_source_visitor* visitor, void* context) -> void
+{
+    auto& source_table = crv::input::source_table();
+    source_table.visit(
+        name, [&](crv_source& source) noexcept { visitor(context, source_table.handle(source), &source); });
+}
+
+extern "C" auto crv_source_configure(crv_source* source, crv_source_config const* config) -> void
+{
+    using matrix_t = crv::input::transform_t::matrix_t;
+
+    auto const& transform = config->transform;
+    source->transform.matrix(matrix_t{{{{transform.xx, transform.xy}, {transform.yx, transform.yy}}}});
+    source->notch.threshold(crv::input::notch_t::threshold_t::literal(config->notch_threshold));
+    source->smoother.halflife_us(config->filter_halflife_us);
+}
+
+extern "C" auto crv_source_move(crv_source* source, int x, int y) -> void
+{
+    auto& pending = source->pending;
+    pending.x = crv::saturate_cast<int32_t>(int64_t{pending.x} + x);
+    pending.y = crv::saturate_cast<int32_t>(int64_t{pending.y} + y);
+}
+
+extern "C" auto crv_source_report(crv_source* source, long long time_us, crv_motion* output) -> int
+{
+    using namespace crv::input;
+
+    auto const pending = probe(CRV_LATENCY_DELTA, [&] {
+        auto const pending = source->pending;
+        if (pending == motion_t{}) return pending;
+        source->pending = motion_t{};
+
+        // neither fractions nor velocity left from a previous motion should affect this one
+        if (source->velocity.idle(time_us))
+        {
+            source->transform_remainder_x.reset();
+            source->transform_remainder_y.reset();
+            source->smoother.reset();
+            source->remainder_x.reset();
+            source->remainder_y.reset();
+        }
+
+        return pending;
+    });
+    if (pending == motion_t{}) return 0;
+
+    // one rsqrt serves both the notch and the speed; speed is measured before snapping, so snapping doesn't slow motion
+    constexpr auto accelerator = prod_accelerator_t{};
+    auto const transformed = probe(CRV_LATENCY_TRANSFORM, [&] { return transform(*source, pending); });
+    struct length_t
+    {
+        prod_accelerator_t::magnitude_t magnitude;
+        prod_accelerator_t::x_t speed;
+    };
+    auto const length = probe(CRV_LATENCY_LENGTH, [&] {
+        auto const magnitude = accelerator.magnitude(transformed);
+        return length_t{magnitude, accelerator.speed(magnitude)};
+    });
+    auto const notched
+        = probe(CRV_LATENCY_NOTCH, [&] { return source->notch(transformed, length.magnitude.inverse_length); });
+    auto const scaled = scale(*source, time_us, notched, length.speed);
+    auto const result = probe(CRV_LATENCY_CARRY, [&] {
+        return motion_t{source->remainder_x(scaled.x).value, source->remainder_y(scaled.y).value};
+    });
+
+    // the carry can round small motion to nothing; an empty report would still sync
+    if (result == motion_t{}) return 0;
+
+    *output = crv_motion{result.x, result.y};
+    return 1;
+}
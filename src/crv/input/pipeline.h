@@ -0,0 +1,118 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief c interface to the c++ input pipeline
+///
+/// The kernel's input handler is c, so it reaches the pipeline through these functions. They compile into both the
+/// kernel module and the user-mode library, so the same code can be benchmarked without loading the module.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+/// relative motion in device counts, coalesced over one report
+struct crv_motion
+{
+    int x;
+    int y;
+};
+
+/// \returns size of the spline payload crv_spline_commit() expects, in bytes
+unsigned long crv_spline_payload_size(void);
+
+/// validates a spline payload, then publishes it as the active spline
+///
+/// The payload is copied once, from staging straight into the active spline's unpublished slot, and it is validated
+/// there, so nothing can change it between validation and publication, even if staging is shared with user space.
+/// Invalid payloads are never published.
+///
+/// \pre calls are serialized
+/// \param staging payload, as written by the config tool
+/// \param size size of the payload the config tool wrote; must match crv_spline_payload_size()
+/// \returns nonzero if the payload was valid and is now published
+int crv_spline_commit(void const* staging, unsigned long size);
+
+/// 2x2 matrix that maps motion before it is scaled, like device_t::rotation and profile_t::anisotropy
+///
+/// Coefficients are fixed point, with 32 fractional bits. Output x is xx*x + xy*y, and output y is yx*x + yy*y.
+struct crv_transform
+{
+    long long xx;
+    long long xy;
+    long long yx;
+    long long yy;
+};
+
+/// per-source settings, built at configuration time and replaced together by crv_source_configure()
+struct crv_source_config
+{
+    /// maps motion before it is scaled, so reports pay for a matrix multiply rather than trig
+    struct crv_transform transform;
+
+    /// how near an axis transformed motion must be to snap onto it, like profile_t::notch_width
+    ///
+    /// Within the notch, the smaller component of transformed motion is dropped. This is the sine of the notch's half
+    /// width, fixed point with 62 fractional bits; 0 disables the notch.
+    unsigned long long notch_threshold;
+
+    /// half-life of the source's velocity smoothing, in microseconds, like profile_t::filter_halflife; 0 disables it
+    ///
+    /// Setting this divides, which is why it is configured rather than computed per report.
+    long long filter_halflife_us;
+};
+
+/// pipeline state for one source device; opaque to c
+struct crv_source;
+
+/// claims state for a newly connected source device
+///
+/// Sources live in a fixed-capacity table, one cache line or more apiece, so devices reporting concurrently on
+/// different cpus never contend. Calls to attach and detach must be serialized.
+///
+/// \param handle identifies the connection; lookups by the same handle find this source
+/// \param name device name, used to match the device's configuration; may be NULL
+/// \returns the source, or NULL if every slot is taken
+struct crv_source* crv_source_attach(void const* handle, char const* name);
+
+/// releases a source's slot
+///
+/// \pre nothing still uses source
+void crv_source_detach(struct crv_source* source);
+
+/// finds the source attached with handle without taking a lock
+///
+/// \returns the source, or NULL if handle is not attached
+struct crv_source* crv_source_find(void const* handle);
+
+/// called by crv_source_visit() with each source it finds, and the handle the source was attached with
+typedef void crv_source_visitor(void* context, void const* handle, struct crv_source* source);
+
+/// calls visitor with every attached source whose device is named name
+///
+/// \pre calls are serialized with attach and detach
+void crv_source_visit(char const* name, crv_source_visitor* visitor, void* context);
+
+/// replaces every setting in the source's configuration
+///
+/// Settings are written one at a time, so this must not race the source's reports, or a report could see some old
+/// settings and some new. The kernel holds the source device's event lock, which its reports already run under.
+///
+/// \pre nothing reports through source concurrently
+/// \param config settings to copy; until configured, sources use an identity transform, no notch, and no smoothing
+void crv_source_configure(struct crv_source* source, struct crv_source_config const* config);
+
+/// adds relative motion to the source's pending report, saturating
+void crv_source_move(struct crv_source* source, int x, int y);
+
+/// ends the source's report, scaling its pending motion by its spline
+///
+/// Pending motion is first mapped through the source's transform, then snapped to an axis if it is within the source's
+/// notch. The spline is then evaluated at the report's velocity, in counts per millisecond, measured from the interval
+/// since the source's previous report and smoothed over the source's filter half-life, so curves behave the same at any
+/// polling rate. Transformed and scaled motion are each rounded to whole counts, and the fraction rounding drops is
+/// carried into the source's next report, so slow motion accumulates rather than vanishing. Smoothing and the carries
+/// all start over after the source has been idle.
+///
+/// \param time_us monotonic time the report was polled, in microseconds
+/// \returns nonzero if the report has motion to emit, in which case output holds it
+int crv_source_report(struct crv_source* source, long long time_us, struct crv_motion* output);
@@ -0,0 +1,80 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief c++ view of the input pipeline's shared state
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+extern "C" {
+#include <crv/input/pipeline.h>
+} // extern "C"
+
+#include <crv/lib.hpp>
+#include <crv/double_buffer.hpp>
+#include <crv/input/accelerator.hpp>
+#include <crv/input/device_table.hpp>
+#include <crv/input/notch.hpp>
+#include <crv/input/remainder.hpp>
+#include <crv/input/smoother.hpp>
+#include <crv/input/transform.hpp>
+#include <crv/input/velocity.hpp>
+#include <crv/spline/prod_spline.hpp>
+
+namespace crv::input {
+
+using prod_accelerator_t = accelerator_t<spline::prod_spline_t>;
+using active_spline_t = double_buffer_t<spline::prod_spline_t>;
+using prod_velocity_estimator_t = velocity_estimator_t<prod_accelerator_t::x_t>;
+using prod_smoother_t = smoother_t<prod_accelerator_t::x_t>;
+using prod_remainder_t
+    = remainder_t<prod_accelerator_t::scaled_t, prod_accelerator_t::out_t, prod_accelerator_t::shifter>;
+using transform_remainder_t = remainder_t<transform_t::scaled_t, transform_t::out_t, transform_t::shifter>;
+
+/// spline every source reports through until configured otherwise; writers publish here
+auto active_spline() noexcept -> active_spline_t&;
+
+} // namespace crv::input
+
+/// pipeline state for one source device
+struct crv_source
+{
+    /// motion since the last report
+    crv::input::motion_t pending{};
+
+    /// rotation and anisotropy, applied before the curve
+    crv::input::transform_t transform{};
+
+    /// fractions of a count left over from transforming previous reports
+    crv::input::transform_remainder_t transform_remainder_x{};
+    crv::input::transform_remainder_t transform_remainder_y{};
+
+    /// snaps transformed motion near an axis onto it
+    crv::input::notch_t notch{};
+
+    /// spline this source's reports are scaled by; set on attach
+    crv::input::active_spline_t const* spline = nullptr;
+
+    /// this source's locate state in whichever slot of spline it reads; the slots themselves are shared
+    crv::spline::prod_spline_t::cursor_t spline_cursor{};
+
+    /// converts each report's length to counts per ms
+    crv::input::prod_velocity_estimator_t velocity{};
+
+    /// averages velocity over the configured half-life
+    crv::input::prod_smoother_t smoother{};
+
+    /// fractions of a count left over from previous reports
+    crv::input::prod_remainder_t remainder_x{};
+    crv::input::prod_remainder_t remainder_y{};
+};
+
+namespace crv::input {
+
+/// room for several pointing devices at once, with headroom for devices that merely report rel axes
+using source_table_t = device_table_t<crv_source, 16>;
+
+/// table crv_source_attach() claims from
+auto source_table() noexcept -> source_table_t&;
+
+} // namespace crv::input
@@ -0,0 +1,187 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "pipeline.hpp"
+#include <crv/input/latency.hpp>
+#include <crv/math/limits.hpp>
+#include <crv/test/test.hpp>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+namespace crv::input {
+namespace {
+
+struct pipeline_source_test_t : Test
+{
+    int handle = 0;
+    crv_source* source = crv_source_attach(&handle, "source");
+
+    ~pipeline_source_test_t() override { crv_source_detach(source); }
+};
+
+TEST_F(pipeline_source_test_t, motion_passes_through_until_spline_is_published)
+{
+    ASSERT_EQ(0, active_spline().read()->payload.segment_locator.segment_count());
+
+    crv_source_move(source, 3, -4);
+
+    auto output = crv_motion{};
+    ASSERT_TRUE(crv_source_report(source, 0, &output));
+    EXPECT_EQ(3, output.x);
+    EXPECT_EQ(-4, output.y);
+}
+
+TEST_F(pipeline_source_test_t, attach_finds_source_by_handle)
+{
+    ASSERT_NE(nullptr, source);
+    EXPECT_EQ(source, crv_source_find(&handle));
+    EXPECT_STREQ("source", source_table().name(*source));
+}
+
+TEST_F(pipeline_source_test_t, attach_uses_active_spline)
+{
+    EXPECT_EQ(&active_spline(), source->spline);
+}
+
+TEST_F(pipeline_source_test_t, visit_finds_sources_and_handles_by_name)
+{
+    int other_handle = 0;
+    auto const other = crv_source_attach(&other_handle, "other");
+
+    struct visited_t
+    {
+        void const* handle;
+        crv_source* source;
+    };
+    auto visited = std::vector<visited_t>{};
+    crv_source_visit(
+        "source",
+        [](void* context, void const* handle, crv_source* source) {
+            static_cast<std::vector<visited_t>*>(context)->push_back({handle, source});
+        },
+        &visited);
+    crv_source_detach(other);
+
+    ASSERT_EQ(1u, visited.size());
+    EXPECT_EQ(static_cast<void const*>(&handle), visited[0].handle);
+    EXPECT_EQ(source, visited[0].source);
+}
+
+TEST_F(pipeline_source_test_t, detach_releases_source)
+{
+    crv_source_detach(source);
+    EXPECT_EQ(nullptr, crv_source_find(&handle));
+
+    // reattach so the fixture has something to detach
+    source = crv_source_attach(&handle, "source");
+}
+
+TEST_F(pipeline_source_test_t, coalesces_motion_until_report)
+{
+    crv_source_move(source, 3, 0);
+    crv_source_move(source, 0, -4);
+    crv_source_move(source, 2, 1);
+
+    auto output = crv_motion{};
+    ASSERT_TRUE(crv_source_report(source, 0, &output));
+    EXPECT_EQ(5, output.x);
+    EXPECT_EQ(-3, output.y);
+
+    // report cleared pending motion
+    EXPECT_FALSE(crv_source_report(source, 0, &output));
+}
+
+TEST_F(pipeline_source_test_t, saturates_pending_motion)
+{
+    crv_source_move(source, max<int>(), min<int>());
+    crv_source_move(source, 1, -1);
+
+    EXPECT_EQ(max<int>(), source->pending.x);
+    EXPECT_EQ(min<int>(), source->pending.y);
+}
+
+TEST_F(pipeline_source_test_t, transforms_motion_before_scaling)
+{
+    constexpr auto one = transform_t::coeff_t{1}.value;
+    auto const quarter_turn = crv_source_config{.transform = {.xx = 0, .xy = -one, .yx = one, .yy = 0}};
+    crv_source_configure(source, &quarter_turn);
+
+    crv_source_move(source, 3, 4);
+
+    auto output = crv_motion{};
+    ASSERT_TRUE(crv_source_report(source, 0, &output));
+    EXPECT_EQ(-4, output.x);
+    EXPECT_EQ(3, output.y);
+}
+
+TEST_F(pipeline_source_test_t, carries_transformed_fractions)
+{
+    constexpr auto half = transform_t::coeff_t{1}.value / 2;
+    auto const halve = crv_source_config{.transform = {.xx = half, .xy = 0, .yx = 0, .yy = half}};
+    crv_source_configure(source, &halve);
+
+    // 1/2 rounds up to 1, then the -1/2 carried cancels the next 1/2
+    auto output = crv_motion{};
+    crv_source_move(source, 1, 0);
+    ASSERT_TRUE(crv_source_report(source, 1000, &output));
+    EXPECT_EQ(1, output.x);
+
+    crv_source_move(source, 1, 0);
+    EXPECT_FALSE(crv_source_report(source, 2000, &output));
+}
+
+TEST_F(pipeline_source_test_t, snaps_transformed_motion_to_axis)
+{
+    constexpr auto one = transform_t::coeff_t{1}.value;
+    // sin(~14.5 degrees)
+    auto const config = crv_source_config{
+        .transform = {.xx = 0, .xy = -one, .yx = one, .yy = 0},
+        .notch_threshold = 1ULL << 60,
+    };
+    crv_source_configure(source, &config);
+
+    // (1, 10) turns to (-10, 1), which is within the notch around x
+    crv_source_move(source, 1, 10);
+
+    auto output = crv_motion{};
+    ASSERT_TRUE(crv_source_report(source, 0, &output));
+    EXPECT_EQ(-10, output.x);
+    EXPECT_EQ(0, output.y);
+}
+
+#if defined CRV_ENABLE_LATENCY_HISTOGRAMS
+
+TEST_F(pipeline_source_test_t, report_probes_its_stages)
+{
+    auto const& counts = crv_latency_local()->counts;
+    auto const total = [&](int stage) {
+        return std::accumulate(std::begin(counts[stage]), std::end(counts[stage]), 0ull);
+    };
+    unsigned long long before[CRV_LATENCY_STAGE_COUNT];
+    for (auto stage = 0; stage < CRV_LATENCY_STAGE_COUNT; ++stage) before[stage] = total(stage);
+
+    crv_source_move(source, 3, -4);
+    auto output = crv_motion{};
+    ASSERT_TRUE(crv_source_report(source, 0, &output));
+
+    // stages that need a spline are only probed once one is published
+    for (auto const stage : {CRV_LATENCY_DELTA, CRV_LATENCY_TRANSFORM, CRV_LATENCY_LENGTH, CRV_LATENCY_NOTCH,
+             CRV_LATENCY_VELOCITY, CRV_LATENCY_CARRY})
+    {
+        EXPECT_EQ(before[stage] + 1, total(stage)) << stage;
+    }
+
+    // the caller probes these around its own calls
+    for (auto const stage : {CRV_LATENCY_FILTER, CRV_LATENCY_REPORT, CRV_LATENCY_EMIT})
+    {
+        EXPECT_EQ(before[stage], total(stage)) << stage;
+    }
+}
+
+#endif
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,62 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief carries the fraction lost rounding scaled motion to whole counts into the next report
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/fixed.hpp>
+
+namespace crv::input {
+
+/// rounds one axis of scaled motion to whole counts, carrying what rounding dropped into the next report
+///
+/// Without a carry, every report loses up to half a count, so slow, steady motion scaled by a small gain can round to
+/// nothing at all. With it, the sum of everything emitted stays within one rounding of the sum of everything scaled.
+///
+/// The carry resets deterministically:
+///   - when the axis reverses, so fractions left over from one direction never push the other
+///   - when output saturates, so motion the output couldn't hold isn't replayed later
+///   - when the caller calls reset(), like after the device goes idle
+template <is_fixed t_in_t, is_fixed t_out_t, auto t_shifter> class remainder_t
+{
+public:
+    using in_t = t_in_t;
+    using out_t = t_out_t;
+
+    static constexpr auto shifter = t_shifter;
+
+    /// \returns scaled plus the carry, rounded by shifter
+    constexpr auto operator()(in_t scaled) noexcept -> out_t
+    {
+        // zero neither moves nor reverses
+        auto const negative = scaled.value ? scaled.value < 0 : negative_;
+        if (negative != negative_) carry_ = in_t{};
+        negative_ = negative;
+
+        auto const total = scaled + carry_;
+        auto const rounded = out_t::template convert<shifter>(total);
+        auto const residue = total - in_t::convert(rounded);
+
+        // rounding leaves less than a count unless the output saturated
+        carry_ = -one < residue && residue < one ? residue : in_t{};
+
+        return rounded;
+    }
+
+    /// drops the carry
+    constexpr auto reset() noexcept -> void { carry_ = in_t{}; }
+
+    /// \returns fraction waiting for the next report
+    constexpr auto carry() const noexcept -> in_t { return carry_; }
+
+private:
+    static constexpr auto one = in_t{1};
+
+    in_t carry_{};
+    bool negative_ = false;
+};
+
+} // namespace crv::input
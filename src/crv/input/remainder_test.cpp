@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "remainder.hpp"
+#include <crv/math/limits.hpp>
+#include <crv/math/rounding_mode.hpp>
+#include <crv/math/shifter.hpp>
+#include <crv/test/test.hpp>
+
+namespace crv::input {
+namespace {
+
+using in_t = fixed_t<int64_t, 8>;
+using out_t = fixed_t<int16_t, 0>;
+using sut_t = remainder_t<in_t, out_t, shifter_t<rounding_modes::shr::fast::nearest_away>{}>;
+
+constexpr auto quarter = in_t::literal(1 << 6);
+constexpr auto half = in_t::literal(1 << 7);
+
+struct remainder_test_t : Test
+{
+    sut_t sut{};
+};
+
+TEST_F(remainder_test_t, whole_counts_pass_through)
+{
+    EXPECT_EQ(out_t{3}, sut(in_t{3}));
+    EXPECT_EQ(out_t{-2}, sut(in_t{-2}));
+    EXPECT_EQ(in_t{}, sut.carry());
+}
+
+TEST_F(remainder_test_t, carries_fractions_into_next_report)
+{
+    auto const three_quarters = half + quarter;
+
+    EXPECT_EQ(out_t{1}, sut(three_quarters));
+    EXPECT_EQ(-quarter, sut.carry());
+
+    EXPECT_EQ(out_t{0}, sut(quarter));
+    EXPECT_EQ(in_t{}, sut.carry());
+}
+
+TEST_F(remainder_test_t, fractions_accumulate_to_whole_counts)
+{
+    auto total = 0;
+    for (auto report = 0; report < 100; ++report) total += sut(quarter).value;
+
+    EXPECT_EQ(25, total);
+}
+
+TEST_F(remainder_test_t, zero_keeps_carry)
+{
+    sut(quarter);
+
+    EXPECT_EQ(out_t{0}, sut(in_t{}));
+    EXPECT_EQ(quarter, sut.carry());
+}
+
+TEST_F(remainder_test_t, reversal_drops_carry)
+{
+    sut(quarter);
+
+    EXPECT_EQ(out_t{0}, sut(-quarter));
+    EXPECT_EQ(-quarter, sut.carry());
+}
+
+TEST_F(remainder_test_t, zero_does_not_reverse)
+{
+    sut(-quarter);
+    sut(in_t{});
+
+    EXPECT_EQ(out_t{-1}, sut(-half));
+}
+
+TEST_F(remainder_test_t, saturation_drops_carry)
+{
+    auto const past_max = in_t{max<int16_t>()} + in_t{2} + quarter;
+
+    EXPECT_EQ(out_t{max<int16_t>()}, sut(past_max));
+    EXPECT_EQ(in_t{}, sut.carry());
+}
+
+TEST_F(remainder_test_t, reset_drops_carry)
+{
+    sut(quarter);
+    sut.reset();
+
+    EXPECT_EQ(in_t{}, sut.carry());
+    EXPECT_EQ(out_t{0}, sut(quarter));
+}
+
+} // namespace
+} // namespace crv::input
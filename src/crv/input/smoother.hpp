@@ -0,0 +1,99 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief exponential velocity smoothing with a half-life measured in time
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/exp2_neg_m1.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/limits.hpp>
+#include <crv/math/rounding_mode.hpp>
+#include <crv/math/shifter.hpp>
+
+namespace crv::input {
+
+/// exponential moving average whose weight depends on the time between samples, not the number of them
+///
+/// After each interval, the previous average keeps decay = 2^-(interval/halflife) of its weight:
+///
+///     smoothed' = smoothed + (decay - 1)(smoothed - sample)
+///
+/// decay - 1 is exactly what exp2_neg_m1_q64_to_q1_63_t computes, and computing it directly keeps full precision for
+/// the short intervals that dominate, where decay is close to 1. Elapsed half-lives are split into whole and fractional
+/// parts. The fraction goes through the polynomial, and the whole part is a shift, so every update costs one multiply,
+/// one polynomial, one shift, and one more multiply, with no division and no data-dependent branches.
+///
+/// A half-life of 0 disables smoothing; every elapsed interval is so many half-lives that decay is 0, so the average
+/// is just the latest sample.
+template <is_fixed t_value_t> class smoother_t
+{
+public:
+    using value_t = t_value_t;
+    using exp2_neg_m1_t = exp2_neg_m1_q64_to_q1_63_t;
+
+    /// decay - 1, in [-1, 0]
+    using decay_m1_t = exp2_neg_m1_t::out_t;
+
+    /// half-lives elapsed; saturates at 2^16
+    using elapsed_t = fixed_t<uint64_t, 48>;
+
+    /// half-lives per microsecond
+    using rate_t = fixed_t<uint64_t, 48>;
+
+    /// \returns 2^-elapsed - 1
+    static auto decay_m1(elapsed_t elapsed) noexcept -> decay_m1_t
+    {
+        constexpr auto one = uint64_t{1} << decay_m1_t::frac_bits;
+        constexpr auto width = uint64_t{64};
+
+        // 2^-(whole + frac) = 2^-whole(2^-frac - 1 + 1); 1 + (2^-frac - 1) is in (1/2, 1], so it fits unsigned
+        auto const whole = elapsed.value >> elapsed_t::frac_bits;
+        auto const frac = exp2_neg_m1_t::in_t::literal(elapsed.value << (width - elapsed_t::frac_bits));
+        auto const frac_decay = one + static_cast<uint64_t>(exp2_neg_m1_t{}(frac).value);
+
+        // shifting by the full width is undefined, and past it, nothing is left anyway; this compiles to a cmov
+        auto const decay = whole < width ? frac_decay >> whole : 0;
+
+        return decay_m1_t::literal(static_cast<int64_t>(decay - one));
+    }
+
+    /// sets the half-life; 0 disables smoothing
+    ///
+    /// This divides, so it belongs at configuration time. It must not race operator(); see crv_source_configure().
+    auto halflife_us(int64_t halflife_us) noexcept -> void
+    {
+        using us_t = fixed_t<uint64_t, 0>;
+
+        rate_ = halflife_us > 0
+            ? divide<rate_t>(us_t{1}, us_t{static_cast<uint64_t>(halflife_us)}, rounding_modes::div::nearest_away)
+            : disabled;
+    }
+
+    /// \returns sample averaged with previous samples, weighted by the interval since the last one
+    auto operator()(value_t sample, int64_t interval_us) noexcept -> value_t
+    {
+        auto const elapsed = elapsed_t::convert(multiply(interval_t{static_cast<uint64_t>(interval_us)}, rate_));
+
+        smoothed_ += multiply<value_t, shifter>(smoothed_ - sample, decay_m1(elapsed));
+        return smoothed_;
+    }
+
+    /// forgets previous samples, as if the device had been still
+    constexpr auto reset() noexcept -> void { smoothed_ = value_t{}; }
+
+private:
+    using interval_t = fixed_t<uint64_t, 0>;
+
+    static constexpr auto disabled = rate_t::literal(max<uint64_t>());
+
+    // both factors are bounded well below the product's width, so biasing can't overflow
+    static constexpr auto shifter = shifter_t<rounding_modes::shr::fast::nearest_away>{};
+
+    rate_t rate_ = disabled;
+    value_t smoothed_{};
+};
+
+} // namespace crv::input
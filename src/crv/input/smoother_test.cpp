@@ -0,0 +1,126 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "smoother.hpp"
+#include <crv/test/test.hpp>
+#include <cmath>
+
+namespace crv::input {
+namespace {
+
+using value_t = fixed_t<int64_t, 42>;
+using sut_t = smoother_t<value_t>;
+using elapsed_t = sut_t::elapsed_t;
+using decay_m1_t = sut_t::decay_m1_t;
+
+auto to_double(auto fixed) -> double
+{
+    return std::ldexp(static_cast<double>(fixed.value), -decltype(fixed)::frac_bits);
+}
+
+auto elapsed(double half_lives) -> elapsed_t
+{
+    return elapsed_t::literal(static_cast<uint64_t>(std::ldexp(half_lives, elapsed_t::frac_bits)));
+}
+
+// ====================================================================================================================
+// decay_m1
+// ====================================================================================================================
+
+TEST(smoother_decay_m1_test, zero_elapsed_keeps_everything)
+{
+    EXPECT_EQ(decay_m1_t{}, sut_t::decay_m1(elapsed_t{}));
+}
+
+TEST(smoother_decay_m1_test, matches_reference_across_range)
+{
+    for (auto const half_lives : {0.001, 0.25, 0.5, 0.999, 1.0, 1.5, 2.0, 2.5, 7.75, 31.0, 62.5})
+    {
+        EXPECT_NEAR(std::exp2(-half_lives) - 1, to_double(sut_t::decay_m1(elapsed(half_lives))), 1e-12) << half_lives;
+    }
+}
+
+TEST(smoother_decay_m1_test, whole_half_lives_are_exact)
+{
+    EXPECT_EQ(decay_m1_t::literal(-(int64_t{1} << 62)), sut_t::decay_m1(elapsed(1)));
+    EXPECT_EQ(decay_m1_t::literal(-(int64_t{3} << 61)), sut_t::decay_m1(elapsed(2)));
+}
+
+TEST(smoother_decay_m1_test, many_half_lives_forget_everything)
+{
+    EXPECT_EQ(decay_m1_t::literal(min<int64_t>()), sut_t::decay_m1(elapsed(64)));
+    EXPECT_EQ(decay_m1_t::literal(min<int64_t>()), sut_t::decay_m1(elapsed_t::literal(max<uint64_t>())));
+}
+
+// ====================================================================================================================
+// smoothing
+// ====================================================================================================================
+
+struct smoother_test_t : Test
+{
+    sut_t sut{};
+};
+
+TEST_F(smoother_test_t, disabled_by_default)
+{
+    EXPECT_EQ(value_t{3}, sut(value_t{3}, 1000));
+    EXPECT_EQ(value_t{7}, sut(value_t{7}, 125));
+    EXPECT_EQ(value_t{1}, sut(value_t{1}, 8000));
+}
+
+TEST_F(smoother_test_t, zero_halflife_disables)
+{
+    sut.halflife_us(2000);
+    sut.halflife_us(0);
+
+    sut(value_t{3}, 1000);
+    EXPECT_EQ(value_t{7}, sut(value_t{7}, 1000));
+}
+
+TEST_F(smoother_test_t, one_halflife_moves_halfway)
+{
+    sut.halflife_us(2000);
+
+    EXPECT_NEAR(4.0, to_double(sut(value_t{8}, 2000)), 1e-9);
+    EXPECT_NEAR(6.0, to_double(sut(value_t{8}, 2000)), 1e-9);
+}
+
+TEST_F(smoother_test_t, converges_to_constant_sample)
+{
+    sut.halflife_us(2000);
+
+    auto result = value_t{};
+    for (auto report = 0; report < 200; ++report) result = sut(value_t{5}, 1000);
+
+    EXPECT_NEAR(5.0, to_double(result), 1e-9);
+}
+
+TEST_F(smoother_test_t, independent_of_polling_rate)
+{
+    auto fast = sut_t{};
+    fast.halflife_us(2000);
+    auto slow = sut_t{};
+    slow.halflife_us(2000);
+
+    auto fast_result = value_t{};
+    for (auto report = 0; report < 8; ++report) fast_result = fast(value_t{10}, 125);
+    auto const slow_result = slow(value_t{10}, 1000);
+
+    EXPECT_NEAR(10 * (1 - std::exp2(-0.5)), to_double(slow_result), 1e-9);
+    EXPECT_NEAR(to_double(slow_result), to_double(fast_result), 1e-9);
+}
+
+TEST_F(smoother_test_t, reset_forgets_samples)
+{
+    sut.halflife_us(2000);
+    sut(value_t{8}, 2000);
+
+    sut.reset();
+
+    EXPECT_NEAR(4.0, to_double(sut(value_t{8}, 2000)), 1e-9);
+}
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,71 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "spline_upload.hpp"
+#include <cassert>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace crv::input {
+
+device_file_t::device_file_t(std::filesystem::path const& path) : fd_{::open(path.c_str(), O_RDWR | O_CLOEXEC)}
+{
+    if (fd_ < 0)
+    {
+        throw std::system_error{errno, std::generic_category(), "device_file_t: failed to open " + path.string()};
+    }
+}
+
+device_file_t::~device_file_t()
+{
+    close();
+}
+
+device_file_t::device_file_t(device_file_t&& src) noexcept
+    : fd_{std::exchange(src.fd_, -1)}, mapping_{std::exchange(src.mapping_, nullptr)},
+      mapping_size_{std::exchange(src.mapping_size_, 0)}
+{}
+
+auto device_file_t::operator=(device_file_t&& src) noexcept -> device_file_t&
+{
+    if (this != &src)
+    {
+        close();
+        fd_ = std::exchange(src.fd_, -1);
+        mapping_ = std::exchange(src.mapping_, nullptr);
+        mapping_size_ = std::exchange(src.mapping_size_, 0);
+    }
+    return *this;
+}
+
+auto device_file_t::map(std::size_t size) -> void*
+{
+    assert(!mapping_ && "device_file_t: already mapped");
+
+    auto const mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    if (mapping == MAP_FAILED) throw std::system_error{errno, std::generic_category(), "device_file_t: failed to map"};
+
+    mapping_ = mapping;
+    mapping_size_ = size;
+    return mapping_;
+}
+
+auto device_file_t::ioctl(unsigned long request, unsigned long arg) noexcept -> int
+{
+    return ::ioctl(fd_, request, arg) < 0 ? -errno : 0;
+}
+
+auto device_file_t::close() noexcept -> void
+{
+    if (mapping_) ::munmap(mapping_, mapping_size_);
+    if (fd_ >= 0) ::close(fd_);
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    fd_ = -1;
+}
+
+} // namespace crv::input
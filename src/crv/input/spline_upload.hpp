@@ -0,0 +1,109 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief uploads splines to the kernel module through its character device
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+extern "C" {
+#include <crv/input/ioctl.h>
+} // extern "C"
+
+#include <crv/lib.hpp>
+#include <crv/input/pipeline.hpp>
+#include <crv/spline/prod_spline.hpp>
+#include <cerrno>
+#include <cstddef>
+#include <filesystem>
+#include <string_view>
+#include <system_error>
+#include <utility>
+
+namespace crv::input {
+
+/// open character device, with at most one mapping
+///
+/// Failures to open or map throw std::system_error. ioctl() returns errors instead, because some are expected.
+class device_file_t
+{
+public:
+    explicit device_file_t(std::filesystem::path const& path);
+    ~device_file_t();
+
+    device_file_t(device_file_t&& src) noexcept;
+    auto operator=(device_file_t&& src) noexcept -> device_file_t&;
+
+    /// maps size bytes from the start of the device, shared and writable; unmapped with the file
+    auto map(std::size_t size) -> void*;
+
+    /// \returns 0, or a negative errno
+    auto ioctl(unsigned long request, unsigned long arg) noexcept -> int;
+
+private:
+    auto close() noexcept -> void;
+
+    int fd_ = -1;
+    void* mapping_ = nullptr;
+    std::size_t mapping_size_ = 0;
+};
+
+/// writes spline payloads into the device's staging buffer and commits them, and configures sources
+///
+/// The staging buffer is mapped once, up front. Each upload writes its payload straight into the mapping, then a
+/// single ioctl has the module validate and publish it, so the payload never passes through a syscall. Per-source
+/// settings are small, so configure() passes them through its ioctl directly.
+///
+/// file_t is the device. It provides map(size) -> void*, which maps the file's staging buffer, and
+/// ioctl(request, arg) -> int, which returns 0 or a negative errno. device_file_t is the real one.
+template <typename t_file_t = device_file_t> class spline_upload_t
+{
+public:
+    using file_t = t_file_t;
+    using payload_t = spline::prod_spline_t::payload_t;
+
+    explicit spline_upload_t(file_t file)
+        : file_{std::move(file)}, staging_{static_cast<payload_t*>(file_.map(sizeof(payload_t)))}
+    {}
+
+    /// \returns staging buffer to write the next payload into
+    auto staging() noexcept -> payload_t& { return *staging_; }
+
+    /// publishes the payload written to staging
+    ///
+    /// \returns true if the module published it, or false if it was invalid
+    auto commit() -> bool
+    {
+        auto const result = file_.ioctl(CRV_IOCTL_COMMIT, sizeof(payload_t));
+        if (result == -EINVAL) return false;
+        if (result) throw std::system_error{-result, std::generic_category(), "spline_upload_t: commit failed"};
+        return true;
+    }
+
+    /// writes payload to staging, then commits it
+    auto upload(payload_t const& payload) -> bool
+    {
+        staging() = payload;
+        return commit();
+    }
+
+    /// replaces the settings of every connected device named name
+    ///
+    /// Names are truncated to fit the request, the same way the module truncates the names it records.
+    auto configure(std::string_view name, crv_source_config const& config) -> void
+    {
+        static_assert(CRV_DEVICE_NAME_CAPACITY == source_table_t::name_capacity);
+
+        auto request = crv_configure_request{.name = {}, .config = config};
+        name.copy(request.name, sizeof(request.name) - 1);
+
+        auto const result = file_.ioctl(CRV_IOCTL_CONFIGURE, reinterpret_cast<unsigned long>(&request));
+        if (result) throw std::system_error{-result, std::generic_category(), "spline_upload_t: configure failed"};
+    }
+
+private:
+    file_t file_;
+    payload_t* staging_;
+};
+
+} // namespace crv::input
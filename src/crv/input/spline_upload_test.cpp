@@ -0,0 +1,210 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "spline_upload.hpp"
+#include <crv/input/pipeline.hpp>
+#include <crv/test/test.hpp>
+#include <array>
+#include <memory>
+#include <string>
+
+namespace crv::input {
+namespace {
+
+using payload_t = spline::prod_spline_t::payload_t;
+using segment_locator_t = spline::prod_segment_locator_t;
+using x_t = segment_locator_t::x_t;
+
+// ====================================================================================================================
+// Fake Device
+// ====================================================================================================================
+
+/// stands in for the module's character device, handing commits to the pipeline the same way the module does
+struct fake_device_t
+{
+    struct state_t
+    {
+        // page aligned and zeroed, like vmalloc_user
+        alignas(4096) std::array<std::byte, (sizeof(payload_t) + 4095) / 4096 * 4096> staging{};
+        std::size_t mapped_size = 0;
+        int commit_count = 0;
+        int forced_error = 0;
+    };
+
+    state_t* state;
+
+    auto map(std::size_t size) -> void*
+    {
+        state->mapped_size = size;
+        return state->staging.data();
+    }
+
+    auto ioctl(unsigned long request, unsigned long arg) noexcept -> int
+    {
+        if (state->forced_error) return state->forced_error;
+
+        switch (request)
+        {
+            case CRV_IOCTL_COMMIT:
+                ++state->commit_count;
+                return crv_spline_commit(state->staging.data(), arg) ? 0 : -EINVAL;
+            case CRV_IOCTL_CONFIGURE: return configure(arg);
+            default: return -ENOTTY;
+        }
+    }
+
+    // copies the request, like copy_from_user, then configures each source, without the event lock nothing here needs
+    static auto configure(unsigned long arg) noexcept -> int
+    {
+        auto request = *reinterpret_cast<crv_configure_request const*>(arg);
+        request.name[CRV_DEVICE_NAME_CAPACITY - 1] = '\0';
+
+        crv_source_visit(
+            request.name,
+            [](void* config, void const*, crv_source* source) {
+                crv_source_configure(source, static_cast<crv_source_config const*>(config));
+            },
+            &request.config);
+        return 0;
+    }
+};
+
+// ====================================================================================================================
+// Tests
+// ====================================================================================================================
+
+auto create_payload(int_t segment_count) -> payload_t
+{
+    auto const stride = x_t{1};
+    auto const x_max = stride * segment_count;
+
+    auto keys = std::array<x_t, segment_locator_t::total_key_count>{};
+    for (auto index = 0; index < segment_locator_t::total_key_count; ++index)
+    {
+        keys[index] = index + 1 < segment_count ? stride * (index + 1) : x_max;
+    }
+
+    auto result = payload_t{};
+    result.segment_locator = segment_locator_t{keys, x_max, segment_count};
+    return result;
+}
+
+struct spline_upload_test_t : Test
+{
+    std::unique_ptr<fake_device_t::state_t> device = std::make_unique<fake_device_t::state_t>();
+    spline_upload_t<fake_device_t> sut{fake_device_t{device.get()}};
+
+    // other tests expect nothing published
+    ~spline_upload_test_t() override { active_spline().publish(spline::prod_spline_t{}); }
+
+    static auto published_segment_count() noexcept -> int_t
+    {
+        return active_spline().read()->payload.segment_locator.segment_count();
+    }
+};
+
+TEST_F(spline_upload_test_t, maps_one_payload)
+{
+    EXPECT_EQ(crv_spline_payload_size(), device->mapped_size);
+    EXPECT_EQ(static_cast<void*>(device->staging.data()), &sut.staging());
+}
+
+TEST_F(spline_upload_test_t, publishes_valid_payload)
+{
+    EXPECT_TRUE(sut.upload(create_payload(5)));
+
+    EXPECT_EQ(1, device->commit_count);
+    EXPECT_EQ(5, published_segment_count());
+}
+
+TEST_F(spline_upload_test_t, publishes_payload_written_in_place)
+{
+    sut.staging().segment_locator = create_payload(7).segment_locator;
+
+    EXPECT_TRUE(sut.commit());
+    EXPECT_EQ(7, published_segment_count());
+}
+
+TEST_F(spline_upload_test_t, rejects_invalid_payload)
+{
+    ASSERT_TRUE(sut.upload(create_payload(5)));
+
+    // an empty locator has no segments
+    EXPECT_FALSE(sut.upload(payload_t{}));
+
+    EXPECT_EQ(5, published_segment_count());
+}
+
+TEST_F(spline_upload_test_t, rejects_mismatched_size)
+{
+    sut.staging() = create_payload(5);
+
+    EXPECT_FALSE(crv_spline_commit(&sut.staging(), crv_spline_payload_size() - 1));
+    EXPECT_EQ(0, published_segment_count());
+}
+
+TEST_F(spline_upload_test_t, recommits_after_rejection)
+{
+    ASSERT_FALSE(sut.upload(payload_t{}));
+
+    EXPECT_TRUE(sut.upload(create_payload(3)));
+    EXPECT_EQ(3, published_segment_count());
+}
+
+TEST_F(spline_upload_test_t, commit_throws_unexpected_errors)
+{
+    device->forced_error = -ENOTTY;
+
+    EXPECT_THROW(sut.commit(), std::system_error);
+}
+
+// --------------------------------------------------------------------------------------------------------------------
+// Configure
+// --------------------------------------------------------------------------------------------------------------------
+
+struct spline_upload_configure_test_t : spline_upload_test_t
+{
+    static constexpr auto one = transform_t::coeff_t{1}.value;
+    static constexpr auto quarter_turn = crv_source_config{.transform = {.xx = 0, .xy = -one, .yx = one, .yy = 0}};
+
+    int handles[2]{};
+    crv_source* mouse = crv_source_attach(&handles[0], "mouse");
+    crv_source* trackball = crv_source_attach(&handles[1], "trackball");
+
+    ~spline_upload_configure_test_t() override
+    {
+        crv_source_detach(trackball);
+        crv_source_detach(mouse);
+    }
+};
+
+TEST_F(spline_upload_configure_test_t, configures_sources_by_name)
+{
+    sut.configure("mouse", quarter_turn);
+
+    EXPECT_EQ((transform_t::matrix_t{{{{0, -one}, {one, 0}}}}), mouse->transform.matrix());
+    EXPECT_EQ(transform_t::identity, trackball->transform.matrix());
+}
+
+TEST_F(spline_upload_configure_test_t, truncates_long_names_like_the_table)
+{
+    crv_source_detach(mouse);
+    auto const long_name = std::string(CRV_DEVICE_NAME_CAPACITY * 2, 'n');
+    mouse = crv_source_attach(&handles[0], long_name.c_str());
+
+    sut.configure(long_name, quarter_turn);
+
+    EXPECT_EQ((transform_t::matrix_t{{{{0, -one}, {one, 0}}}}), mouse->transform.matrix());
+}
+
+TEST_F(spline_upload_configure_test_t, configure_throws_errors)
+{
+    device->forced_error = -EFAULT;
+
+    EXPECT_THROW(sut.configure("mouse", quarter_turn), std::system_error);
+}
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,81 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief rotates and anisotropically scales motion with one fixed-point matrix
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/input/accelerator.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/linear.hpp>
+#include <crv/math/rounding_mode.hpp>
+#include <crv/math/shifter.hpp>
+
+namespace crv::input {
+
+/// maps each report's motion through a 2x2 matrix before the curve sees it
+///
+/// Rotation and anisotropic scaling are both linear, so configuration folds them into one matrix, and each report costs
+/// four multiplies and two adds, with no trig. The matrix is built in user mode, where there is float; see
+/// model::transform_matrix().
+///
+/// Coefficients are q31.32. Counts are widened before multiplying, so products keep every bit, and scale() returns them
+/// unrounded, so callers can carry the fraction into the next report the same way they carry the curve's.
+class transform_t
+{
+public:
+    using coeff_t = fixed_t<int64_t, 32>;
+    using scaled_t = fixed_t<int128_t, coeff_t::frac_bits>;
+    using out_t = fixed_t<int32_t, 0>;
+
+    /// raw coefficients, row major, so matrix * column vector maps input to output
+    using matrix_t = math::matrix_t<coeff_t::value_t, 2, 2>;
+
+    /// motion mapped through the matrix, before rounding to whole counts
+    struct scaled_motion_t
+    {
+        scaled_t x;
+        scaled_t y;
+
+        constexpr auto operator==(scaled_motion_t const&) const noexcept -> bool = default;
+    };
+
+    // coefficients are bounded by the config's soft limits, so sums of products stay far below 127 bits
+    static constexpr auto shifter = shifter_t<rounding_modes::shr::fast::nearest_away>{};
+
+    static constexpr auto identity = matrix_t{{{{coeff_t{1}.value, 0}, {0, coeff_t{1}.value}}}};
+
+    /// \returns matrix currently applied
+    auto matrix() const noexcept -> matrix_t const& { return matrix_; }
+
+    /// replaces the matrix
+    ///
+    /// Coefficients are replaced one at a time, so this must not race scale(); see crv_source_configure().
+    auto matrix(matrix_t const& matrix) noexcept -> void { matrix_ = matrix; }
+
+    /// \returns matrix * motion, unrounded
+    auto scale(motion_t motion) const noexcept -> scaled_motion_t
+    {
+        auto const product = matrix() * math::vector_t<int128_t, 2>{motion.x, motion.y};
+        return {scaled_t::literal(product[0]), scaled_t::literal(product[1])};
+    }
+
+    /// \returns matrix * motion, rounded to whole counts
+    auto operator()(motion_t motion) const noexcept -> motion_t
+    {
+        auto const scaled = scale(motion);
+        return {round(scaled.x), round(scaled.y)};
+    }
+
+private:
+    static constexpr auto round(scaled_t scaled) noexcept -> int32_t
+    {
+        return out_t::template convert<shifter>(scaled).value;
+    }
+
+    matrix_t matrix_ = identity;
+};
+
+} // namespace crv::input
@@ -0,0 +1,89 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "transform.hpp"
+#include <crv/math/limits.hpp>
+#include <crv/test/test.hpp>
+
+namespace crv::input {
+namespace {
+
+using coeff_t = transform_t::coeff_t;
+using matrix_t = transform_t::matrix_t;
+using scaled_t = transform_t::scaled_t;
+
+constexpr auto one = coeff_t{1}.value;
+constexpr auto half = one / 2;
+
+struct transform_test_t : Test
+{
+    transform_t sut{};
+};
+
+TEST_F(transform_test_t, defaults_to_identity)
+{
+    EXPECT_EQ(transform_t::identity, sut.matrix());
+    EXPECT_EQ((motion_t{3, -4}), sut(motion_t{3, -4}));
+}
+
+TEST_F(transform_test_t, matrix_round_trips)
+{
+    auto const expected = matrix_t{{{{1, 2}, {3, 4}}}};
+
+    sut.matrix(expected);
+
+    EXPECT_EQ(expected, sut.matrix());
+}
+
+TEST_F(transform_test_t, maps_column_vector)
+{
+    sut.matrix(matrix_t{{{{2 * one, 3 * one}, {-one, 5 * one}}}});
+
+    EXPECT_EQ((motion_t{2 * 7 + 3 * -11, -7 + 5 * -11}), sut(motion_t{7, -11}));
+}
+
+TEST_F(transform_test_t, rotates_quarter_turn)
+{
+    sut.matrix(matrix_t{{{{0, -one}, {one, 0}}}});
+
+    EXPECT_EQ((motion_t{-4, 3}), sut(motion_t{3, 4}));
+}
+
+TEST_F(transform_test_t, scale_keeps_fraction)
+{
+    sut.matrix(matrix_t{{{{half, 0}, {0, -half}}}});
+
+    auto const actual = sut.scale(motion_t{3, 3});
+
+    EXPECT_EQ(scaled_t::literal(3 * half), actual.x);
+    EXPECT_EQ(scaled_t::literal(-3 * half), actual.y);
+}
+
+TEST_F(transform_test_t, rounds_to_nearest_away_from_zero)
+{
+    sut.matrix(matrix_t{{{{half, 0}, {0, half}}}});
+
+    EXPECT_EQ((motion_t{2, -2}), sut(motion_t{3, -3}));
+    EXPECT_EQ((motion_t{1, -1}), sut(motion_t{1, -1}));
+}
+
+TEST_F(transform_test_t, widens_before_multiplying)
+{
+    sut.matrix(matrix_t{{{{1000 * one, 1000 * one}, {0, 0}}}});
+
+    auto const actual = sut.scale(motion_t{max<int32_t>(), max<int32_t>()});
+
+    EXPECT_EQ(scaled_t::literal(int128_t{2000} * max<int32_t>() * one), actual.x);
+}
+
+TEST_F(transform_test_t, saturates_rounded_output)
+{
+    sut.matrix(matrix_t{{{{2 * one, 0}, {0, 2 * one}}}});
+
+    EXPECT_EQ((motion_t{max<int32_t>(), min<int32_t>()}), sut(motion_t{max<int32_t>(), min<int32_t>()}));
+}
+
+} // namespace
+} // namespace crv::input
@@ -0,0 +1,90 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief estimates pointer velocity from report timestamps
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/algorithm.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/rounding_mode.hpp>
+
+namespace crv::input {
+
+/// converts each report's length in counts to a velocity in counts per millisecond
+///
+/// Reports are timestamped when the device is polled, so the interval between consecutive timestamps is the interval
+/// the report's motion covers. Dividing by it makes the curve's input independent of polling rate: a device polled at
+/// 1 kHz sees the same velocities it saw per report, and devices polled faster or slower see the same curve.
+///
+/// Intervals are sanitized before use:
+///   - reports batched under one timestamp, or timestamps that go backward, reuse the last interval
+///   - intervals longer than max_interval_us are the first report after a pause, not a slow poll, so they also reuse
+///     the last interval rather than reading a flick as a crawl
+///   - intervals shorter than min_interval_us are jitter and are clamped
+///
+/// Dividing is the expensive part, so the reciprocal of the interval is computed with the division stack, then cached,
+/// and reports that reuse an interval only pay for the multiply.
+template <is_fixed t_x_t> class velocity_estimator_t
+{
+public:
+    using x_t = t_x_t;
+
+    /// 1/ms, as 1000/interval_us; at most 1000/min_interval_us, so a few integer bits suffice
+    using reciprocal_t = fixed_t<int64_t, 56>;
+
+    /// 8 kHz, the fastest common polling rate
+    static constexpr auto min_interval_us = int64_t{125};
+
+    /// 125 Hz, the slowest common polling rate, with room for jitter
+    static constexpr auto max_interval_us = int64_t{12'000};
+
+    /// reports this far apart are separate motions
+    static constexpr auto idle_interval_us = int64_t{100'000};
+
+    /// assumed until the device's first measurable interval; reproduces per-report velocity at 1 kHz
+    static constexpr auto initial_interval_us = int64_t{1000};
+    static_assert(1000 % initial_interval_us == 0, "velocity_estimator_t: initial reciprocal must be exact");
+
+    /// \returns length / interval since the previous report, in counts per ms
+    ///
+    /// This is not constexpr because the division stack divides with inline asm.
+    auto operator()(int64_t time_us, x_t length) noexcept -> x_t
+    {
+        auto interval_us = time_us - last_time_us_;
+        last_time_us_ = time_us;
+
+        if (interval_us <= 0 || interval_us > max_interval_us) interval_us = interval_us_;
+        interval_us = max(interval_us, min_interval_us);
+
+        if (interval_us != interval_us_)
+        {
+            interval_us_ = interval_us;
+            reciprocal_ = reciprocal(interval_us);
+        }
+
+        return x_t::convert(multiply(length, reciprocal_));
+    }
+
+    /// \returns true if a report at time_us would start a new motion
+    constexpr auto idle(int64_t time_us) const noexcept -> bool { return time_us - last_time_us_ > idle_interval_us; }
+
+    /// \returns interval the last report was measured over
+    constexpr auto interval_us() const noexcept -> int64_t { return interval_us_; }
+
+private:
+    using us_t = fixed_t<int64_t, 0>;
+
+    static auto reciprocal(int64_t interval_us) noexcept -> reciprocal_t
+    {
+        return divide<reciprocal_t>(us_t{1000}, us_t{interval_us}, rounding_modes::div::nearest_away);
+    }
+
+    int64_t last_time_us_ = 0;
+    int64_t interval_us_ = initial_interval_us;
+    reciprocal_t reciprocal_ = reciprocal_t{1000 / initial_interval_us};
+};
+
+} // namespace crv::input
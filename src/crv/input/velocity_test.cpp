@@ -0,0 +1,113 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "velocity.hpp"
+#include <crv/test/test.hpp>
+
+namespace crv::input {
+namespace {
+
+using x_t = fixed_t<int64_t, 42>;
+using sut_t = velocity_estimator_t<x_t>;
+
+struct velocity_estimator_test_t : Test
+{
+    sut_t sut{};
+
+    static auto near(x_t expected, x_t actual) -> bool
+    {
+        // the reciprocal rounds to 56 bits, then the product truncates to 42
+        constexpr auto tolerance = int64_t{2};
+        auto const error = actual.value - expected.value;
+        return -tolerance <= error && error <= tolerance;
+    }
+};
+
+TEST_F(velocity_estimator_test_t, first_report_assumes_1_khz)
+{
+    EXPECT_EQ(x_t{6}, sut(500'000'000, x_t{6}));
+    EXPECT_EQ(sut_t::initial_interval_us, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, divides_by_interval_in_ms)
+{
+    sut(1'000'000, x_t{1});
+
+    EXPECT_TRUE(near(x_t{8}, sut(1'000'500, x_t{4})));
+    EXPECT_EQ(500, sut.interval_us());
+
+    EXPECT_TRUE(near(x_t{8}, sut(1'008'500, x_t{64})));
+    EXPECT_EQ(8000, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, same_velocity_across_polling_rates)
+{
+    // 8 counts/ms polled at 125 Hz, 1 kHz, and 8 kHz
+    auto slow = sut_t{};
+    auto medium = sut_t{};
+    auto fast = sut_t{};
+    slow(0, x_t{});
+    medium(0, x_t{});
+    fast(0, x_t{});
+
+    EXPECT_TRUE(near(x_t{8}, slow(8000, x_t{64})));
+    EXPECT_TRUE(near(x_t{8}, medium(1000, x_t{8})));
+    EXPECT_TRUE(near(x_t{8}, fast(125, x_t{1})));
+}
+
+TEST_F(velocity_estimator_test_t, batched_reports_reuse_last_interval)
+{
+    sut(1'000'000, x_t{});
+    sut(1'000'250, x_t{});
+
+    EXPECT_TRUE(near(x_t{12}, sut(1'000'250, x_t{3})));
+    EXPECT_EQ(250, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, backward_time_reuses_last_interval)
+{
+    sut(1'000'000, x_t{});
+    sut(1'002'000, x_t{});
+
+    EXPECT_TRUE(near(x_t{3}, sut(1'001'000, x_t{6})));
+    EXPECT_EQ(2000, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, pauses_reuse_last_interval)
+{
+    sut(1'000'000, x_t{});
+    sut(1'000'500, x_t{});
+
+    // a flick after a pause reads as a flick
+    EXPECT_TRUE(near(x_t{40}, sut(3'000'000, x_t{20})));
+    EXPECT_EQ(500, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, clamps_short_intervals)
+{
+    sut(1'000'000, x_t{});
+
+    EXPECT_TRUE(near(x_t{8}, sut(1'000'010, x_t{1})));
+    EXPECT_EQ(sut_t::min_interval_us, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, longest_interval_is_accepted)
+{
+    sut(1'000'000, x_t{});
+
+    sut(1'000'000 + sut_t::max_interval_us, x_t{});
+    EXPECT_EQ(sut_t::max_interval_us, sut.interval_us());
+}
+
+TEST_F(velocity_estimator_test_t, idle_after_idle_interval)
+{
+    sut(1'000'000, x_t{});
+
+    EXPECT_FALSE(sut.idle(1'000'000 + sut_t::idle_interval_us));
+    EXPECT_TRUE(sut.idle(1'000'000 + sut_t::idle_interval_us + 1));
+}
+
+} // namespace
+} // namespace crv::input
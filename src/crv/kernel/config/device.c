@@ -0,0 +1,143 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief misc character device implementation
+///
+/// Opening the device allocates a staging buffer, zeroed and sized to hold one spline payload. The config tool maps it
+/// with mmap, writes a payload directly into the mapping, and commits it with CRV_IOCTL_COMMIT, which hands it to
+/// crv_spline_commit() to validate and publish. No payload ever goes through copy_from_user.
+///
+/// The buffer stays mapped after a commit, so the pipeline copies it into the active spline's unpublished slot before
+/// validating it, and user space can't change it once it has been checked. That copy is the only one.
+///
+/// Per-source settings are a few dozen bytes, so CRV_IOCTL_CONFIGURE just copies them in and hands them to the input
+/// handler, which applies them under each matching device's event lock.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "device.h"
+#include <crv/input/ioctl.h>
+#include <crv/input/pipeline.h>
+#include <crv/kernel/input/handler.h>
+#include <linux/compat.h>
+#include <linux/fs.h>
+#include <linux/miscdevice.h>
+#include <linux/mm.h>
+#include <linux/mutex.h>
+#include <linux/stringify.h>
+#include <linux/uaccess.h>
+#include <linux/vmalloc.h>
+
+/// serializes commits, which are the active spline's only writer
+static DEFINE_MUTEX(crv_commit_mutex);
+
+/// \returns size of each file's staging buffer, rounded up to whole pages so all of it can be mapped
+static unsigned long crv_staging_size(void)
+{
+    return PAGE_ALIGN(crv_spline_payload_size());
+}
+
+// ====================================================================================================================
+// File Operations
+// ====================================================================================================================
+
+static int crv_open(struct inode* inode, struct file* file)
+{
+    // vmalloc_user zeroes the buffer and marks it mappable, so nothing stale from the kernel reaches user space
+    void* const staging = vmalloc_user(crv_staging_size());
+    if (!staging) return -ENOMEM;
+
+    file->private_data = staging;
+    return 0;
+}
+
+static int crv_release(struct inode* inode, struct file* file)
+{
+    // every mapping holds a reference to the file, so release only runs once they are all gone
+    vfree(file->private_data);
+    return 0;
+}
+
+static int crv_mmap(struct file* file, struct vm_area_struct* vma)
+{
+    // the staging buffer is the only thing to map, and it starts at offset 0
+    if (vma->vm_pgoff) return -EINVAL;
+
+    return remap_vmalloc_range(vma, file->private_data, 0);
+}
+
+static long crv_commit(struct file* file, unsigned long size)
+{
+    int published;
+
+    mutex_lock(&crv_commit_mutex);
+    published = crv_spline_commit(file->private_data, size);
+    mutex_unlock(&crv_commit_mutex);
+
+    return published ? 0 : -EINVAL;
+}
+
+static long crv_configure(void __user* arg)
+{
+    struct crv_configure_request request;
+
+    if (copy_from_user(&request, arg, sizeof(request))) return -EFAULT;
+
+    // user space need not terminate the name
+    request.name[sizeof(request.name) - 1] = '\0';
+
+    crv_input_handler_configure(request.name, &request.config);
+    return 0;
+}
+
+static long crv_ioctl(struct file* file, unsigned int cmd, unsigned long arg)
+{
+    switch (cmd)
+    {
+        case CRV_IOCTL_COMMIT: return crv_commit(file, arg);
+        case CRV_IOCTL_CONFIGURE: return crv_configure((void __user*)arg);
+        default: return -ENOTTY;
+    }
+}
+
+#ifdef CONFIG_COMPAT
+static long crv_compat_ioctl(struct file* file, unsigned int cmd, unsigned long arg)
+{
+    // commit's argument is a size, which needs no translation, but configure's is a pointer; the request's layout is
+    // the same for both abis, since every field is either chars or a long long at a multiple of 8
+    if (cmd == CRV_IOCTL_CONFIGURE) arg = (unsigned long)compat_ptr(arg);
+    return crv_ioctl(file, cmd, arg);
+}
+#endif
+
+static struct file_operations const crv_fops = {
+    .owner = THIS_MODULE,
+    .open = crv_open,
+    .release = crv_release,
+    .mmap = crv_mmap,
+    .unlocked_ioctl = crv_ioctl,
+#ifdef CONFIG_COMPAT
+    .compat_ioctl = crv_compat_ioctl,
+#endif
+};
+
+// ====================================================================================================================
+// Registration
+// ====================================================================================================================
+
+/// name matches dist/udev.rules.in, which grants the input group access and tags it for restore.service
+static struct miscdevice crv_device = {
+    .minor = MISC_DYNAMIC_MINOR,
+    .name = __stringify(CRV_DEVICE_NAME),
+    .fops = &crv_fops,
+};
+
+int crv_config_device_register(void)
+{
+    return misc_register(&crv_device);
+}
+
+void crv_config_device_unregister(void)
+{
+    misc_deregister(&crv_device);
+}
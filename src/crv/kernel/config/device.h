@@ -0,0 +1,15 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief misc character device the config tool uploads splines through
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+/// creates the character device
+///
+/// \returns 0 on success, or a negative errno
+int crv_config_device_register(void);
+
+/// removes the character device
+void crv_config_device_unregister(void);
@@ -4,7 +4,9 @@
 /// \brief kernel module entry point
 /// \copyright Copyright (C) 2026 Frank Secilia
 
-#include <crv/kernel/cxx_build_test.h>
+#include <crv/kernel/config/device.h>
+#include <crv/kernel/input/handler.h>
+#include <crv/kernel/input/latency.h>
 #include <linux/errno.h>
 #include <linux/init.h>
 #include <linux/module.h>
@@ -12,13 +14,35 @@
 
 static int __init crv_init(void)
 {
-    printk("crv_init with c++\n");
+    int error;
 
-    return (reference_cxx() >> 16) - 1;
+    printk("crv_init\n");
+
+    // histograms come up first and go down last, so they cover everything the handler records
+    crv_latency_register();
+
+    error = crv_input_handler_register();
+    if (error) goto err_unregister_latency;
+
+    // the device goes last, so anything that finds it can rely on the handler being up
+    error = crv_config_device_register();
+    if (error) goto err_unregister_handler;
+
+    return 0;
+
+err_unregister_handler:
+    crv_input_handler_unregister();
+err_unregister_latency:
+    crv_latency_unregister();
+    return error;
 }
 
 static void __exit crv_exit(void)
 {
+    crv_config_device_unregister();
+    crv_input_handler_unregister();
+    crv_latency_unregister();
+
     printk("crv_exit\n");
 }
 
@@ -2,6 +2,266 @@
 
 /// \file
 /// \brief linux input handler implementation
+///
+/// The handler filters every device reporting REL_X and REL_Y. It swallows their motion, coalesces it until
+/// SYN_REPORT, scales it through the pipeline, then reports the result from a single virtual output device. Everything
+/// else, like buttons and wheels, passes through the original device untouched.
+///
+/// Scaled motion can't be injected back into the source device, because filters run under its event lock, and the
+/// output device can't be created per source, because connect() runs under the input core's mutex, so one output
+/// device is created up front and shared.
+///
 /// \copyright Copyright (C) 2026 Frank Secilia
 
 #include "handler.h"
+#include <crv/input/latency.h>
+#include <crv/input/pipeline.h>
+#include <linux/input.h>
+#include <linux/mutex.h>
+#include <linux/slab.h>
+#include <linux/spinlock.h>
+
+#define CRV_OUTPUT_NAME "crv pointer"
+#define CRV_OUTPUT_PHYS "crv/input0"
+
+/// one filtered source device
+struct crv_handle
+{
+    struct input_handle handle;
+
+    /// claimed on connect, so the filter never has to look it up; only touched under the source device's event lock
+    struct crv_source* source;
+};
+
+static struct input_dev* crv_output;
+
+/// keeps each report's REL_X, REL_Y, and SYN_REPORT together when several sources report at once
+static DEFINE_SPINLOCK(crv_output_lock);
+
+/// serializes claiming and releasing sources with configuring them, so configuration never visits a changing table
+static DEFINE_MUTEX(crv_sources_mutex);
+
+// ====================================================================================================================
+// Event Filtering
+// ====================================================================================================================
+
+static void crv_report(struct crv_handle* crv_handle)
+{
+    struct crv_motion motion;
+    unsigned long flags;
+    int emitted;
+    CRV_LATENCY_DECLARE(start_cycles);
+
+    ktime_t const time = input_get_timestamp(crv_handle->handle.dev)[INPUT_CLK_MONO];
+
+    CRV_LATENCY_START(start_cycles);
+    emitted = crv_source_report(crv_handle->source, ktime_to_us(time), &motion);
+    CRV_LATENCY_STOP(CRV_LATENCY_REPORT, start_cycles);
+
+    if (!emitted) return;
+
+    CRV_LATENCY_START(start_cycles);
+
+    spin_lock_irqsave(&crv_output_lock, flags);
+    input_report_rel(crv_output, REL_X, motion.x);
+    input_report_rel(crv_output, REL_Y, motion.y);
+    input_sync(crv_output);
+    spin_unlock_irqrestore(&crv_output_lock, flags);
+
+    CRV_LATENCY_STOP(CRV_LATENCY_EMIT, start_cycles);
+}
+
+static void crv_move(struct crv_handle* crv_handle, int x, int y)
+{
+    CRV_LATENCY_DECLARE(start_cycles);
+
+    CRV_LATENCY_START(start_cycles);
+    crv_source_move(crv_handle->source, x, y);
+    CRV_LATENCY_STOP(CRV_LATENCY_FILTER, start_cycles);
+}
+
+/// \returns true to swallow the event
+static bool crv_filter(struct input_handle* handle, unsigned int type, unsigned int code, int value)
+{
+    struct crv_handle* crv_handle = container_of(handle, struct crv_handle, handle);
+
+    switch (type)
+    {
+        case EV_REL:
+            switch (code)
+            {
+                case REL_X: crv_move(crv_handle, value, 0); return true;
+                case REL_Y: crv_move(crv_handle, 0, value); return true;
+                default: return false;
+            }
+
+        case EV_SYN:
+            if (code == SYN_REPORT) crv_report(crv_handle);
+            return false;
+
+        default: return false;
+    }
+}
+
+// ====================================================================================================================
+// Connection
+// ====================================================================================================================
+
+static bool crv_match(struct input_handler* handler, struct input_dev* dev)
+{
+    // never filter our own output
+    return dev != crv_output;
+}
+
+static int crv_connect(struct input_handler* handler, struct input_dev* dev, struct input_device_id const* id)
+{
+    struct crv_handle* crv_handle;
+    int error;
+
+    crv_handle = kzalloc(sizeof(*crv_handle), GFP_KERNEL);
+    if (!crv_handle) return -ENOMEM;
+
+    crv_handle->handle.dev = dev;
+    crv_handle->handle.handler = handler;
+    crv_handle->handle.name = handler->name;
+
+    // connect and disconnect run under the input core's mutex, which serializes attach and detach with each other, but
+    // not with configuration
+    mutex_lock(&crv_sources_mutex);
+    crv_handle->source = crv_source_attach(&crv_handle->handle, dev->name);
+    mutex_unlock(&crv_sources_mutex);
+    if (!crv_handle->source)
+    {
+        error = -ENOSPC;
+        goto err_free_handle;
+    }
+
+    error = input_register_handle(&crv_handle->handle);
+    if (error) goto err_detach_source;
+
+    error = input_open_device(&crv_handle->handle);
+    if (error) goto err_unregister_handle;
+
+    return 0;
+
+err_unregister_handle:
+    input_unregister_handle(&crv_handle->handle);
+err_detach_source:
+    mutex_lock(&crv_sources_mutex);
+    crv_source_detach(crv_handle->source);
+    mutex_unlock(&crv_sources_mutex);
+err_free_handle:
+    kfree(crv_handle);
+    return error;
+}
+
+static void crv_disconnect(struct input_handle* handle)
+{
+    struct crv_handle* crv_handle = container_of(handle, struct crv_handle, handle);
+
+    input_close_device(handle);
+
+    // unregistering waits for filters already running, so nothing can still be using the source
+    input_unregister_handle(handle);
+    mutex_lock(&crv_sources_mutex);
+    crv_source_detach(crv_handle->source);
+    mutex_unlock(&crv_sources_mutex);
+
+    kfree(crv_handle);
+}
+
+static struct input_device_id const crv_ids[] = {
+    {
+        .flags = INPUT_DEVICE_ID_MATCH_EVBIT | INPUT_DEVICE_ID_MATCH_RELBIT,
+        .evbit = {BIT_MASK(EV_REL)},
+        .relbit = {BIT_MASK(REL_X) | BIT_MASK(REL_Y)},
+    },
+    {},
+};
+
+static struct input_handler crv_input_handler = {
+    .filter = crv_filter,
+    .match = crv_match,
+    .connect = crv_connect,
+    .disconnect = crv_disconnect,
+    .name = "crv",
+    .id_table = crv_ids,
+};
+
+// ====================================================================================================================
+// Configuration
+// ====================================================================================================================
+
+/// configures one source while its device can't report
+static void crv_configure_source(void* config, void const* handle, struct crv_source* source)
+{
+    struct input_dev* const dev = ((struct input_handle const*)handle)->dev;
+    unsigned long flags;
+
+    // filters run under the device's event lock, so holding it keeps every report entirely before or after this
+    spin_lock_irqsave(&dev->event_lock, flags);
+    crv_source_configure(source, config);
+    spin_unlock_irqrestore(&dev->event_lock, flags);
+}
+
+void crv_input_handler_configure(char const* name, struct crv_source_config const* config)
+{
+    mutex_lock(&crv_sources_mutex);
+    crv_source_visit(name, crv_configure_source, (void*)config);
+    mutex_unlock(&crv_sources_mutex);
+}
+
+// ====================================================================================================================
+// Registration
+// ====================================================================================================================
+
+static int crv_output_register(void)
+{
+    int error;
+
+    crv_output = input_allocate_device();
+    if (!crv_output) return -ENOMEM;
+
+    crv_output->name = CRV_OUTPUT_NAME;
+    crv_output->phys = CRV_OUTPUT_PHYS;
+    crv_output->id.bustype = BUS_VIRTUAL;
+
+    input_set_capability(crv_output, EV_REL, REL_X);
+    input_set_capability(crv_output, EV_REL, REL_Y);
+
+    // udev only classifies relative devices with a left button as mice; it is never pressed
+    input_set_capability(crv_output, EV_KEY, BTN_LEFT);
+
+    error = input_register_device(crv_output);
+    if (error)
+    {
+        input_free_device(crv_output);
+        crv_output = NULL;
+    }
+
+    return error;
+}
+
+int crv_input_handler_register(void)
+{
+    int error;
+
+    error = crv_output_register();
+    if (error) return error;
+
+    error = input_register_handler(&crv_input_handler);
+    if (error)
+    {
+        input_unregister_device(crv_output);
+        crv_output = NULL;
+    }
+
+    return error;
+}
+
+void crv_input_handler_unregister(void)
+{
+    input_unregister_handler(&crv_input_handler);
+    input_unregister_device(crv_output);
+    crv_output = NULL;
+}
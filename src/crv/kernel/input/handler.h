@@ -5,3 +5,18 @@
 /// \copyright Copyright (C) 2026 Frank Secilia
 
 #pragma once
+
+struct crv_source_config;
+
+/// creates the output device and starts filtering relative motion from every mouse
+///
+/// \returns 0 on success, or a negative errno
+int crv_input_handler_register(void);
+
+/// stops filtering and removes the output device
+void crv_input_handler_unregister(void);
+
+/// replaces the configuration of every connected source device named name
+///
+/// Each source is configured under its device's event lock, so none of its reports see a partial configuration.
+void crv_input_handler_configure(char const* name, struct crv_source_config const* config);
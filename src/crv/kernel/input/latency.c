@@ -0,0 +1,82 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief per-cpu latency histogram storage and debugfs export
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "latency.h"
+#include <crv/input/latency.h>
+
+#ifdef CRV_ENABLE_LATENCY_HISTOGRAMS
+
+#include <linux/debugfs.h>
+#include <linux/percpu.h>
+#include <linux/seq_file.h>
+#include <linux/stringify.h>
+
+static DEFINE_PER_CPU(struct crv_latency, crv_latency);
+
+static struct dentry* crv_latency_dir;
+
+static char const* const crv_latency_stage_names[CRV_LATENCY_STAGE_COUNT] = {
+    [CRV_LATENCY_FILTER] = "filter",
+    [CRV_LATENCY_REPORT] = "report",
+    [CRV_LATENCY_DELTA] = "delta",
+    [CRV_LATENCY_TRANSFORM] = "transform",
+    [CRV_LATENCY_LENGTH] = "length",
+    [CRV_LATENCY_NOTCH] = "notch",
+    [CRV_LATENCY_VELOCITY] = "velocity",
+    [CRV_LATENCY_LOCATE] = "locate",
+    [CRV_LATENCY_EVALUATE] = "evaluate",
+    [CRV_LATENCY_SCALE] = "scale",
+    [CRV_LATENCY_CARRY] = "carry",
+    [CRV_LATENCY_EMIT] = "emit",
+};
+
+struct crv_latency* crv_latency_local(void)
+{
+    return this_cpu_ptr(&crv_latency);
+}
+
+static int crv_latency_show(struct seq_file* file, void* unused)
+{
+    int stage;
+    int bucket;
+    int cpu;
+
+    // each cpu keeps writing while this reads, so the sums are a snapshot, not an instant
+    for (stage = 0; stage < CRV_LATENCY_STAGE_COUNT; ++stage)
+    {
+        unsigned long long cycles = 0;
+
+        for_each_possible_cpu(cpu) cycles += READ_ONCE(per_cpu_ptr(&crv_latency, cpu)->cycles[stage]);
+        seq_printf(file, "%s %llu", crv_latency_stage_names[stage], cycles);
+
+        for (bucket = 0; bucket < CRV_LATENCY_BUCKET_COUNT; ++bucket)
+        {
+            unsigned long long count = 0;
+
+            for_each_possible_cpu(cpu) count += READ_ONCE(per_cpu_ptr(&crv_latency, cpu)->counts[stage][bucket]);
+
+            seq_printf(file, " %llu", count);
+        }
+        seq_putc(file, '\n');
+    }
+
+    return 0;
+}
+DEFINE_SHOW_ATTRIBUTE(crv_latency);
+
+void crv_latency_register(void)
+{
+    crv_latency_dir = debugfs_create_dir(__stringify(CRV_DEVICE_NAME), NULL);
+    debugfs_create_file("latency", 0444, crv_latency_dir, NULL, &crv_latency_fops);
+}
+
+void crv_latency_unregister(void)
+{
+    debugfs_remove_recursive(crv_latency_dir);
+    crv_latency_dir = NULL;
+}
+
+#endif
@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: GPL-2.0+ OR MIT
+
+/// \file
+/// \brief exports the hot path's latency histograms through debugfs
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#ifdef CRV_ENABLE_LATENCY_HISTOGRAMS
+
+/// creates <debugfs>/<device name>/latency
+///
+/// Each line of the file is one stage's name, followed by its count in every bucket, summed across cpus. Failing to
+/// create it is not an error; debugfs may be disabled or unmounted.
+void crv_latency_register(void);
+
+/// removes the debugfs file
+void crv_latency_unregister(void);
+
+#else
+
+static inline void crv_latency_register(void) {}
+static inline void crv_latency_unregister(void) {}
+
+#endif
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief division by an invariant divisor via its precomputed reciprocal
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/division/hardware_divider.hpp>
+#include <crv/math/division/qr_pair.hpp>
+#include <crv/math/division/wide_divider.hpp>
+#include <crv/math/int_traits.hpp>
+#include <crv/math/integer.hpp>
+#include <crv/math/limits.hpp>
+#include <bit>
+#include <cassert>
+#include <climits>
+
+namespace crv::division {
+
+/// divides by one divisor, fixed at construction, by multiplying by its precomputed reciprocal
+///
+/// This is the 2-by-1 division from Möller and Granlund, "Improved Division by Invariant Integers." Like libdivide, it
+/// trades the divisor for a multiply-high magic number and a shift, but the dividend is two words wide, as
+/// wide_divider_t passes it. The divisor is normalized so its msb is set, and its reciprocal,
+/// v = floor((2^2n - 1)/d) - 2^n, is computed once. After that, each division is two multiplies, a few adds, and two
+/// corrections, the second of which is rarely taken.
+///
+/// It satisfies is_hardware_divider, so wide_divider_t brackets it with rounding modes and long division exactly as it
+/// does the native instruction; see reciprocal_divider_t.
+///
+/// \pre upper half of dividend must be strictly less than divisor
+/// \pre divisor passed to operator() is the one passed to the constructor
+template <unsigned_integral t_narrow_t> class reciprocal_t
+{
+public:
+    using narrow_t = t_narrow_t;
+    using wide_t = widened_t<narrow_t>;
+
+    static constexpr auto narrow_width = static_cast<int_t>(sizeof(narrow_t) * CHAR_BIT);
+
+    /// precomputes divisor's reciprocal
+    ///
+    /// This divides, so it belongs at configuration time.
+    ///
+    /// \pre divisor > 0
+    explicit constexpr reciprocal_t(narrow_t divisor) noexcept
+        : divisor_{divisor}, shift_{normalizing_shift(divisor)},
+          normalized_divisor_{static_cast<narrow_t>(divisor << shift_)},
+          reciprocal_{compute_reciprocal(normalized_divisor_)}
+    {}
+
+    /// \returns divisor the reciprocal was computed for
+    constexpr auto divisor() const noexcept -> narrow_t { return divisor_; }
+
+    constexpr auto operator()(wide_t dividend, narrow_t divisor) const noexcept -> qr_pair_t<narrow_t>
+    {
+        assert(divisor == divisor_ && "reciprocal_t: divisor differs from the one the reciprocal was computed for");
+        assert(static_cast<narrow_t>(dividend >> narrow_width) < divisor && "reciprocal_t: quotient would overflow");
+        static_cast<void>(divisor);
+
+        // normalizing both sides leaves the quotient unchanged and scales the remainder, which is undone below
+        auto const normalized = int_cast<wide_t>(dividend << shift_);
+        auto const high = static_cast<narrow_t>(normalized >> narrow_width);
+        auto const low = static_cast<narrow_t>(normalized);
+
+        // estimate quotient from reciprocal; (q1, q0) = v*high + (high, low), which wraps mod 2^2n
+        auto const estimate = static_cast<wide_t>(static_cast<wide_t>(reciprocal_) * high + normalized);
+        auto quotient = static_cast<narrow_t>((estimate >> narrow_width) + 1);
+        auto const estimate_low = static_cast<narrow_t>(estimate);
+
+        // remainder, mod 2^n; the estimate is at most one too large, or, rarely, one too small
+        auto remainder = static_cast<narrow_t>(low - static_cast<narrow_t>(quotient * normalized_divisor_));
+
+        // the first correction is taken about half the time, so it is applied with a mask rather than a branch
+        auto const too_large = static_cast<narrow_t>(-static_cast<narrow_t>(remainder > estimate_low));
+        quotient = static_cast<narrow_t>(quotient + too_large);
+        remainder = static_cast<narrow_t>(remainder + (too_large & normalized_divisor_));
+        if (remainder >= normalized_divisor_) [[unlikely]]
+        {
+            quotient = static_cast<narrow_t>(quotient + 1);
+            remainder = static_cast<narrow_t>(remainder - normalized_divisor_);
+        }
+
+        return {.quotient = quotient, .remainder = static_cast<narrow_t>(remainder >> shift_)};
+    }
+
+private:
+    static constexpr auto normalizing_shift(narrow_t divisor) noexcept -> int_t
+    {
+        assert(divisor > 0 && "reciprocal_t: divisor must be positive");
+        return static_cast<int_t>(std::countl_zero(divisor));
+    }
+
+    /// v = floor((2^2n - 1)/d) - 2^n = floor((~d*2^n + 2^n - 1)/d); ~d < d because d's msb is set, so it fits
+    ///
+    /// At runtime, this uses hardware_divider_t; a plain wide division would call into libgcc, which the kernel lacks.
+    static constexpr auto compute_reciprocal(narrow_t normalized_divisor) noexcept -> narrow_t
+    {
+        auto const dividend = int_cast<wide_t>(
+            (int_cast<wide_t>(static_cast<narrow_t>(~normalized_divisor)) << narrow_width) | max<narrow_t>());
+        if consteval { return static_cast<narrow_t>(dividend / normalized_divisor); }
+        else { return hardware_divider_t<narrow_t>{}(dividend, normalized_divisor).quotient; }
+    }
+
+    narrow_t divisor_;
+    int_t shift_;
+    narrow_t normalized_divisor_;
+    narrow_t reciprocal_;
+};
+
+/// wide divider that divides by one invariant divisor without a div instruction
+///
+/// This is wide_divider_t over reciprocal_t, so every rounding mode and the long division path behave exactly as they
+/// do over hardware_divider_t. Construct one per divisor and pass it to shifted_int_divider_t in place of the default:
+///
+///     auto const divide = shifted_int_divider_t<reciprocal_divider_t<uint64_t>, shift, out_t, lhs_t, rhs_t>{
+///         reciprocal_divider_t<uint64_t>{reciprocal_t<uint64_t>{divisor}}};
+///
+/// Each call must pass the same divisor the reciprocal was computed for.
+template <unsigned_integral narrow_t> using reciprocal_divider_t = wide_divider_t<narrow_t, reciprocal_t<narrow_t>>;
+
+} // namespace crv::division
@@ -0,0 +1,274 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "reciprocal_divider.hpp"
+#include <crv/math/division/divider.hpp>
+#include <crv/math/division/io.hpp>
+#include <crv/math/rounding_mode.hpp>
+#include <crv/test/test.hpp>
+#include <limits>
+#include <random>
+
+namespace crv::division {
+namespace {
+
+// compile-time check to ensure reciprocal_t remains constexpr-friendly
+static_assert(reciprocal_t<uint8_t>{3}(100, 3) == qr_pair_t<uint8_t>{33, 1});
+static_assert(reciprocal_t<uint64_t>{10}(uint128_t{1} << 64, 10).quotient == 1844674407370955161u);
+
+// plugs into wide_divider_t the same way hardware_divider_t does
+static_assert(is_hardware_divider<reciprocal_t<uint32_t>, uint32_t>);
+static_assert(is_wide_divider<reciprocal_divider_t<uint32_t>, uint32_t, rounding_modes::div::nearest_even_t>);
+
+// ====================================================================================================================
+// reciprocal_t
+// ====================================================================================================================
+
+namespace reciprocal {
+
+// exhaustive over every divisor and every dividend whose quotient fits
+TEST(reciprocal_t_exhaustive_test, uint8)
+{
+    using narrow_t = uint8_t;
+    using wide_t = uint16_t;
+
+    for (auto divisor = 1; divisor <= max<narrow_t>(); ++divisor)
+    {
+        auto const sut = reciprocal_t<narrow_t>{static_cast<narrow_t>(divisor)};
+        auto const dividend_limit = divisor << 8;
+        for (auto dividend = 0; dividend < dividend_limit; ++dividend)
+        {
+            auto const expected = qr_pair_t<narrow_t>{
+                static_cast<narrow_t>(dividend / divisor), static_cast<narrow_t>(dividend % divisor)};
+            auto const actual = sut(static_cast<wide_t>(dividend), static_cast<narrow_t>(divisor));
+            if (expected != actual)
+            {
+                ADD_FAILURE() << "dividend = " << dividend << ", divisor = " << divisor;
+                return;
+            }
+        }
+    }
+}
+
+template <typename t_narrow_t> struct reciprocal_t_test_t : Test
+{
+    using narrow_t = t_narrow_t;
+    using wide_t = widened_t<narrow_t>;
+    using result_t = qr_pair_t<narrow_t>;
+    using sut_t = reciprocal_t<narrow_t>;
+
+    static constexpr auto narrow_width = std::numeric_limits<narrow_t>::digits;
+
+    static constexpr auto make_dividend(narrow_t high, narrow_t low) -> wide_t
+    {
+        return int_cast<wide_t>((int_cast<wide_t>(high) << narrow_width) | low);
+    }
+
+    static constexpr auto expected(wide_t dividend, narrow_t divisor) -> result_t
+    {
+        return {static_cast<narrow_t>(dividend / divisor), static_cast<narrow_t>(dividend % divisor)};
+    }
+
+    auto test(wide_t dividend, narrow_t divisor) const -> void
+    {
+        EXPECT_EQ(expected(dividend, divisor), sut_t{divisor}(dividend, divisor))
+            << "dividend = " << static_cast<uint64_t>(static_cast<uint128_t>(dividend) >> 64) << ":"
+            << static_cast<uint64_t>(dividend) << ", divisor = " << static_cast<uint64_t>(divisor);
+    }
+};
+
+using narrow_types_t = Types<uint8_t, uint16_t, uint32_t, uint64_t>;
+TYPED_TEST_SUITE(reciprocal_t_test_t, narrow_types_t);
+
+TYPED_TEST(reciprocal_t_test_t, basics)
+{
+    this->test(0, 1);
+    this->test(1, 1);
+    this->test(2, 1);
+    this->test(1, 2);
+    this->test(2, 2);
+    this->test(3, 2);
+    this->test(100, 3);
+}
+
+TYPED_TEST(reciprocal_t_test_t, divisor_one)
+{
+    using narrow_t = TestFixture::narrow_t;
+
+    this->test(max<narrow_t>(), 1);
+}
+
+TYPED_TEST(reciprocal_t_test_t, max_divisor)
+{
+    using narrow_t = TestFixture::narrow_t;
+
+    this->test(0, max<narrow_t>());
+    this->test(max<narrow_t>(), max<narrow_t>());
+    this->test(TestFixture::make_dividend(max<narrow_t>() - 1, max<narrow_t>()), max<narrow_t>());
+}
+
+// divisors that are already normalized, and those that need the most shifting
+TYPED_TEST(reciprocal_t_test_t, powers_of_two)
+{
+    using narrow_t = TestFixture::narrow_t;
+
+    for (auto shift = 0; shift < TestFixture::narrow_width; ++shift)
+    {
+        auto const divisor = static_cast<narrow_t>(narrow_t{1} << shift);
+        this->test(TestFixture::make_dividend(static_cast<narrow_t>(divisor - 1), max<narrow_t>()), divisor);
+        this->test(TestFixture::make_dividend(0, max<narrow_t>()), divisor);
+    }
+}
+
+// largest quotient for each divisor
+TYPED_TEST(reciprocal_t_test_t, largest_dividend)
+{
+    using narrow_t = TestFixture::narrow_t;
+
+    for (auto const divisor : {narrow_t{3}, narrow_t{7}, narrow_t{10}, static_cast<narrow_t>(max<narrow_t>() / 3)})
+    {
+        this->test(TestFixture::make_dividend(static_cast<narrow_t>(divisor - 1), max<narrow_t>()), divisor);
+    }
+}
+
+TYPED_TEST(reciprocal_t_test_t, random)
+{
+    using narrow_t = TestFixture::narrow_t;
+
+    auto rng = std::mt19937_64{0x5eed};
+    auto dist = std::uniform_int_distribution<uint64_t>{1, max<narrow_t>()};
+
+    for (auto iteration = 0; iteration < 10'000; ++iteration)
+    {
+        auto const divisor = static_cast<narrow_t>(dist(rng));
+        auto const high = static_cast<narrow_t>(dist(rng) % divisor);
+        auto const low = static_cast<narrow_t>(dist(rng));
+
+        this->test(TestFixture::make_dividend(high, low), divisor);
+    }
+}
+
+} // namespace reciprocal
+
+// ====================================================================================================================
+// reciprocal_divider_t
+//
+// Compares against wide_divider_t over hardware_divider_t, which it replaces, for every rounding mode.
+// ====================================================================================================================
+
+namespace divider {
+
+using narrow_t = uint64_t;
+using wide_t = uint128_t;
+
+using reference_t = wide_divider_t<narrow_t, hardware_divider_t<narrow_t>>;
+
+template <typename rounding_mode_t> struct reciprocal_divider_test_t : Test
+{
+    static constexpr auto rounding_mode = rounding_mode_t{};
+    static constexpr auto reference = reference_t{};
+
+    auto test(wide_t dividend, narrow_t divisor) const -> void
+    {
+        auto const sut = reciprocal_divider_t<narrow_t>{reciprocal_t<narrow_t>{divisor}};
+        EXPECT_EQ(reference(dividend, divisor, rounding_mode), sut(dividend, divisor, rounding_mode))
+            << "dividend = " << static_cast<uint64_t>(dividend >> 64) << ":" << static_cast<uint64_t>(dividend)
+            << ", divisor = " << divisor;
+    }
+};
+
+using rounding_modes_t = Types<rounding_modes::div::truncate_t, rounding_modes::div::nearest_away_t,
+    rounding_modes::div::nearest_even_t>;
+TYPED_TEST_SUITE(reciprocal_divider_test_t, rounding_modes_t);
+
+// ties, which are where the rounding modes differ
+TYPED_TEST(reciprocal_divider_test_t, ties)
+{
+    for (auto quotient = wide_t{0}; quotient < 8; ++quotient)
+    {
+        this->test(quotient * 2 + 1, 2);
+        this->test(quotient * 10 + 5, 10);
+    }
+}
+
+// quotients wider than a word take the long division path
+TYPED_TEST(reciprocal_divider_test_t, long_division)
+{
+    this->test(max<wide_t>(), 1);
+    this->test(max<wide_t>(), 3);
+    this->test(max<wide_t>(), max<narrow_t>());
+    this->test(wide_t{1} << 100, 10);
+}
+
+TYPED_TEST(reciprocal_divider_test_t, random)
+{
+    auto rng = std::mt19937_64{0x5eed};
+    auto word_dist = std::uniform_int_distribution<narrow_t>{0, max<narrow_t>()};
+    auto divisor_dist = std::uniform_int_distribution<narrow_t>{1, max<narrow_t>()};
+
+    for (auto iteration = 0; iteration < 10'000; ++iteration)
+    {
+        auto const dividend = (static_cast<wide_t>(word_dist(rng)) << 64) | word_dist(rng);
+        this->test(dividend, divisor_dist(rng));
+    }
+}
+
+} // namespace divider
+
+// ====================================================================================================================
+// shifted_int_divider_t
+//
+// Compares against the default division stack.
+// ====================================================================================================================
+
+namespace shifted {
+
+constexpr auto shift = 32;
+
+template <typename out_value_t, typename lhs_t, typename rhs_t>
+auto test(lhs_t dividend, rhs_t divisor) -> void
+{
+    using narrow_t = detail::common_narrow_unsigned_t<lhs_t, rhs_t>;
+    using reciprocal_divider_t = reciprocal_divider_t<narrow_t>;
+    using sut_t = shifted_int_divider_t<reciprocal_divider_t, shift, out_value_t, lhs_t, rhs_t>;
+
+    // the stack divides by the divisor's magnitude
+    auto const abs_divisor = cmp_less(divisor, 0) ? static_cast<narrow_t>(-static_cast<narrow_t>(divisor))
+                                                  : static_cast<narrow_t>(divisor);
+    auto const sut = sut_t{reciprocal_divider_t{reciprocal_t<narrow_t>{abs_divisor}}};
+
+    auto const expected
+        = divide<out_value_t, lhs_t, rhs_t, shift>(dividend, divisor, rounding_modes::div::nearest_even);
+    auto const actual = sut(dividend, divisor, rounding_modes::div::nearest_even);
+
+    EXPECT_EQ(expected, actual) << "dividend = " << dividend << ", divisor = " << divisor;
+}
+
+TEST(reciprocal_shifted_int_divider_test, unsigned)
+{
+    test<uint64_t, uint64_t, uint64_t>(1, 3);
+    test<uint64_t, uint64_t, uint64_t>(1000, 7);
+    test<uint64_t, uint64_t, uint64_t>(uint64_t{1} << 31, 1);
+    test<uint64_t, uint32_t, uint32_t>(12345, 678);
+}
+
+TEST(reciprocal_shifted_int_divider_test, mixed_sign)
+{
+    test<int64_t, int64_t, int64_t>(-1000, 7);
+    test<int64_t, int64_t, int64_t>(1000, -7);
+    test<int64_t, int64_t, int64_t>(-1000, -7);
+    test<int64_t, int32_t, uint32_t>(-5, 2);
+}
+
+TEST(reciprocal_shifted_int_divider_test, saturates)
+{
+    test<int32_t, int64_t, int64_t>(int64_t{1} << 30, 1);
+    test<int32_t, int64_t, int64_t>(-(int64_t{1} << 30), 1);
+}
+
+} // namespace shifted
+
+} // namespace
+} // namespace crv::division
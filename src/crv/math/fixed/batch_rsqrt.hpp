@@ -0,0 +1,108 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief reciprocal square roots of several inputs at once
+///
+/// rsqrt_t's latency is its Newton-Raphson chain: each iteration's multiplies wait on the last, so one input at a time
+/// leaves the multiplier mostly idle. batch_rsqrt_t runs lane_count independent inputs through the same steps in
+/// lockstep, so their chains overlap, and each step's constants are loaded once for every lane. This suits offline
+/// tools, like replay, that have many lengths in hand at once; the per-event path only ever has one.
+///
+/// Each lane runs exactly rsqrt_t's steps, so results are bit-identical to it.
+///
+/// The lanes are scalar. avx2 has no 64x64->128 multiply, and emulating one bit-exactly takes four 32x32->64
+/// multiplies plus carry fixups, which costs more than the mulx it would replace. Lanes are kept in arrays, so the
+/// compiler is free to vectorize the steps it can, like normalization's shifts.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/rsqrt.hpp>
+#include <array>
+#include <span>
+#include <type_traits>
+
+namespace crv {
+
+/// rsqrt_t of lane_count inputs at once
+template <typename t_rsqrt_t, int_t t_lane_count>
+    requires(t_lane_count > 0)
+struct batch_rsqrt_t
+{
+    using rsqrt_t = t_rsqrt_t;
+    using in_t = rsqrt_t::in_t;
+    using out_t = rsqrt_t::out_t;
+    using nr_t = rsqrt_t::nr_t;
+    using normalized_t = rsqrt_t::normalized_t;
+    using normalized_rsqrt_t = std::remove_cvref_t<decltype(std::declval<rsqrt_t>().normalized_rsqrt)>;
+
+    static constexpr auto lane_count = t_lane_count;
+
+    using lanes_in_t = std::array<in_t, lane_count>;
+    using lanes_out_t = std::array<out_t, lane_count>;
+
+    [[no_unique_address]] rsqrt_t rsqrt{};
+
+    /// \returns rsqrt of each lane
+    /// \pre every lane > 0
+    template <typename shifter_t = shifter_t<>>
+    constexpr auto operator()(lanes_in_t const& x, shifter_t shifter = {}) const noexcept -> lanes_out_t
+    {
+        auto const& normalized_rsqrt = rsqrt.normalized_rsqrt;
+
+        auto normalized = std::array<normalized_t, lane_count>{};
+        for (auto lane = 0; lane < lane_count; ++lane)
+        {
+            assert(x[lane].value > 0);
+            normalized[lane] = rsqrt_t::normalize(x[lane]);
+        }
+
+        auto y = std::array<nr_t, lane_count>{};
+        for (auto lane = 0; lane < lane_count; ++lane)
+        {
+            y[lane] = normalized_rsqrt.initial_guess(normalized[lane].x_norm);
+        }
+
+        for (int_t i = 0; i < normalized_rsqrt_t::iteration_count - 1; ++i)
+        {
+            for (auto lane = 0; lane < lane_count; ++lane)
+            {
+                y[lane] = normalized_rsqrt.step(normalized[lane].x_norm, y[lane]);
+            }
+        }
+
+        auto result = lanes_out_t{};
+        for (auto lane = 0; lane < lane_count; ++lane)
+        {
+            auto const y_norm = normalized_rsqrt.final_step(normalized[lane].x_norm, y[lane]);
+            result[lane] = rsqrt_t::denormalize(y_norm, normalized[lane].x_norm_frac_bits, shifter);
+        }
+        return result;
+    }
+
+    /// writes rsqrt of each element of in to out, lane_count at a time; a partial batch at the end goes through rsqrt_t
+    /// \pre out.size() == in.size(), and every element of in > 0
+    template <typename shifter_t = shifter_t<>>
+    constexpr auto operator()(std::span<in_t const> in, std::span<out_t> out, shifter_t shifter = {}) const noexcept
+        -> void
+    {
+        assert(out.size() == in.size() && "batch_rsqrt_t: output size must match input size");
+
+        auto const size = std::ssize(in);
+        auto index = int_t{0};
+        for (; index + lane_count <= size; index += lane_count)
+        {
+            auto lanes = lanes_in_t{};
+            for (auto lane = 0; lane < lane_count; ++lane) lanes[lane] = in[index + lane];
+
+            auto const results = (*this)(lanes, shifter);
+            for (auto lane = 0; lane < lane_count; ++lane) out[index + lane] = results[lane];
+        }
+
+        for (; index < size; ++index) out[index] = rsqrt(in[index], shifter);
+    }
+};
+
+} // namespace crv
@@ -0,0 +1,122 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "batch_rsqrt.hpp"
+#include <crv/math/limits.hpp>
+#include <crv/test/test.hpp>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+namespace crv {
+namespace {
+
+template <typename t_rsqrt_t, int_t t_lane_count> struct batch_rsqrt_param_t
+{
+    using rsqrt_t = t_rsqrt_t;
+    static constexpr auto lane_count = t_lane_count;
+};
+
+template <typename param_t> struct batch_rsqrt_test_t : Test
+{
+    using rsqrt_t = param_t::rsqrt_t;
+    using sut_t = batch_rsqrt_t<rsqrt_t, param_t::lane_count>;
+    using in_t = sut_t::in_t;
+    using out_t = sut_t::out_t;
+
+    static constexpr auto lane_count = sut_t::lane_count;
+
+    sut_t sut{};
+    rsqrt_t reference{};
+
+    /// compares each input against the scalar path, lane_count at a time, repeating the last to fill a batch
+    auto test(std::vector<in_t> const& inputs) const -> void
+    {
+        for (auto first = int_t{0}; first < std::ssize(inputs); first += lane_count)
+        {
+            auto lanes = typename sut_t::lanes_in_t{};
+            for (auto lane = int_t{0}; lane < lane_count; ++lane)
+            {
+                lanes[lane] = inputs[std::min(first + lane, std::ssize(inputs) - 1)];
+            }
+
+            auto const actual = sut(lanes);
+            for (auto lane = int_t{0}; lane < lane_count; ++lane)
+            {
+                ASSERT_EQ(reference(lanes[lane]), actual[lane]) << "x = " << lanes[lane].value;
+            }
+        }
+    }
+};
+
+// prod accelerator's rsqrt, and the benchmark's
+using prod_rsqrt_t = rsqrt_t<fixed_t<uint64_t, 62>, fixed_t<uint64_t, 0>>;
+using benchmark_rsqrt_t = rsqrt_t<fixed_t<uint64_t, 62>, fixed_t<uint32_t, 0>>;
+
+using batch_rsqrt_params_t = Types<batch_rsqrt_param_t<prod_rsqrt_t, 1>, batch_rsqrt_param_t<prod_rsqrt_t, 4>,
+    batch_rsqrt_param_t<prod_rsqrt_t, 8>, batch_rsqrt_param_t<benchmark_rsqrt_t, 4>,
+    batch_rsqrt_param_t<benchmark_rsqrt_t, 8>>;
+TYPED_TEST_SUITE(batch_rsqrt_test_t, batch_rsqrt_params_t);
+
+TYPED_TEST(batch_rsqrt_test_t, matches_scalar_at_small_counts)
+{
+    using in_t = TestFixture::in_t;
+
+    auto inputs = std::vector<in_t>{};
+    for (auto x = 1; x <= 1024; ++x) inputs.push_back(in_t::literal(x));
+
+    this->test(inputs);
+}
+
+TYPED_TEST(batch_rsqrt_test_t, matches_scalar_at_powers_of_two_and_neighbors)
+{
+    using in_t = TestFixture::in_t;
+    using value_t = in_t::value_t;
+
+    auto inputs = std::vector<in_t>{};
+    for (auto bit = 1; bit < std::numeric_limits<value_t>::digits; ++bit)
+    {
+        auto const power = value_t{1} << bit;
+        inputs.push_back(in_t::literal(power - 1));
+        inputs.push_back(in_t::literal(power));
+        inputs.push_back(in_t::literal(power + 1));
+    }
+    inputs.push_back(in_t::literal(max<value_t>()));
+
+    this->test(inputs);
+}
+
+TYPED_TEST(batch_rsqrt_test_t, matches_scalar_at_random_inputs)
+{
+    using in_t = TestFixture::in_t;
+    using value_t = in_t::value_t;
+
+    auto rng = std::mt19937_64{0xc0ffee};
+    auto dist = std::uniform_int_distribution<value_t>{1, max<value_t>()};
+
+    auto inputs = std::vector<in_t>{};
+    for (auto i = 0; i < 4096; ++i) inputs.push_back(in_t::literal(dist(rng)));
+
+    this->test(inputs);
+}
+
+TYPED_TEST(batch_rsqrt_test_t, span_covers_partial_batch)
+{
+    using in_t = TestFixture::in_t;
+    using out_t = TestFixture::out_t;
+
+    // two full batches and most of a third
+    auto const size = 3 * TestFixture::lane_count - 1;
+    auto in = std::vector<in_t>{};
+    for (auto x = 0; x < size; ++x) in.push_back(in_t::literal(3 * x + 1));
+
+    auto out = std::vector<out_t>(in.size());
+    this->sut(std::span<in_t const>{in}, std::span<out_t>{out});
+
+    for (auto index = 0; index < size; ++index) EXPECT_EQ(this->reference(in[index]), out[index]) << "index " << index;
+}
+
+} // namespace
+} // namespace crv
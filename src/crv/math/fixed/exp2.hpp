@@ -27,6 +27,8 @@ public:
     constexpr auto eval(fixed_t<in_value_t, in_frac_bits> const& input) const noexcept
         -> fixed_t<out_value_t, out_frac_bits>
     {
+        using out_t = fixed_t<out_value_t, out_frac_bits>;
+
         uint64_t result, frac_part_norm;
         int final_shift;
         int int_part;
@@ -38,8 +40,8 @@ public:
 
         // Save int part in Q64.0. This is part of the final shift.
         int_part = input.value >> in_frac_bits;
-        if (int_part > 65) [[unlikely]] { return max<uint64_t>(); }
-        if (int_part < -65) [[unlikely]] { return 0; }
+        if (int_part > 65) [[unlikely]] { return out_t::literal(max<out_value_t>()); }
+        if (int_part < -65) [[unlikely]] { return out_t::literal(0); }
         // int_part now fits into a standard int.
 
         // Normalize frac part into a Q0.64.
@@ -71,22 +73,21 @@ public:
         // result is the number of fractional bits of coefficient 0. Shift
         // the remaining int part, then shift into the final output precision.
         final_shift = out_frac_bits - poly_frac_bits[0] + int_part;
-        using out_t = fixed_t<out_value_t, out_frac_bits>;
         if (final_shift > 0)
         {
             auto const shl = final_shift;
-            if (shl >= 64) [[unlikely]] { return max<uint64_t>(); }
-            return out_t{result << shl};
+            if (shl >= 64) [[unlikely]] { return out_t::literal(max<out_value_t>()); }
+            return out_t::literal(result << shl);
         }
         else if (final_shift < 0)
         {
             auto const shr = -final_shift;
-            if (shr >= 64) [[unlikely]] { return 0; }
-            return out_t{static_cast<out_value_t>(result >> shr) + ((result >> (shr - 1)) & 1ULL)};
+            if (shr >= 64) [[unlikely]] { return out_t::literal(0); }
+            return out_t::literal(static_cast<out_value_t>(result >> shr) + ((result >> (shr - 1)) & 1ULL));
         }
         else
         {
-            return out_t{result};
+            return out_t::literal(result);
         }
     }
 
@@ -0,0 +1,27 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "log2.hpp"
+
+namespace crv {
+
+int64_t const log2_t::poly_coeffs[] = {
+    -5156245162493535139LL, // -5.459386920940784787640658472285e-4*x^14 (Q-10.73)
+    5497593933210693151LL, // 4.656643192054814592499360747919e-3*x^13 (Q-7.70)
+    -5514202419990036950LL, // -1.868284451024382501300482021931e-2*x^12 (Q-5.68)
+    7015776262217546738LL, // 4.754074915730310120488063437492e-2*x^11 (Q-4.67)
+    -6496995338770088412LL, // -8.805070576153407136456072809414e-2*x^10 (Q-3.66)
+    4818269549603490045LL, // 1.305994578325214219029448168533e-1*x^9 (Q-2.65)
+    -6211242055986083292LL, // -1.683560532733360666472841833602e-1*x^8 (Q-2.65)
+    7471081852207301947LL, // 2.025040793745045782686212362653e-1*x^7 (Q-2.65)
+    -8842273419297949392LL, // -2.396703012728416599550181555436e-1*x^6 (Q-2.65)
+    5320445796551807344LL, // 2.884219445606419829117047385011e-1*x^5 (Q-1.64)
+    -6653044050878813549LL, // -3.606622406802285272227818748283e-1*x^4 (Q-1.64)
+    8870996236899896427LL, // 4.808976696078801130029751949694e-1*x^3 (Q-1.64)
+    -6653256362303611854LL, // -7.213475002112580359571154620962e-1*x^2 (Q0.63)
+    6653256547942947406LL, // 1.442695040676630252827148638767e+0*x^1 (Q1.62)
+};
+
+} // namespace crv
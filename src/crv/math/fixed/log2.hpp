@@ -0,0 +1,140 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief fixed point approximation of log2(x)
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/limits.hpp>
+#include <bit>
+#include <utility>
+
+namespace crv {
+
+/// log2(x), from countl_zero and one minimax polynomial over [1, 2)
+///
+/// eval() normalizes its input with countl_zero, so the leading 1 lands in the msb. The bit position is the integer
+/// part of the log, and everything below the leading 1 is the fraction of a mantissa in [1, 2).
+///
+/// The kernel, operator(), evaluates a degree-14 minimax approximation of log2(1 + x) over [0, 1) with Horner's method.
+/// Coefficients alternate in sign, so the loop is signed, and each is stored in the q format its partial Horner sum
+/// needs over the whole domain. The endpoints are pinned, p(0) = 0 and p(1) = 1, so results meet at every power of two.
+/// The approximation error is below 2^-40. Rounding in each step adds a few ulps of noise below that, so adjacent
+/// full-width results can step back by an ulp or two.
+///
+/// log2(1 + x) is only analytic out to x = -1, which is close enough to the domain that each degree buys about 2.6
+/// bits. Degree 14 matches exp2_neg_m1_q64_to_q1_63_t's precision. The steps are unrolled at compile time, so every
+/// shift is an immediate.
+///
+/// Coefficients are generated by tools/gen_poly_coeffs.py log2.
+class log2_t
+{
+public:
+    // input:  Q0.64 unsigned — x in [0, 1)
+    // output: Q1.63 unsigned — log2(1 + x) in [0, 1]
+    using in_t = fixed_t<uint64_t, 64>;
+    using out_t = fixed_t<uint64_t, 63>;
+
+    static constexpr auto in_frac_bits = in_t::frac_bits;
+    static constexpr auto out_frac_bits = out_t::frac_bits;
+
+    static auto prefetch() noexcept -> void
+    {
+        constexpr auto read_only = 0;
+        constexpr auto high_locality = 3; // Keep in L1
+        __builtin_prefetch(poly_coeffs, read_only, high_locality);
+    }
+
+    /// \returns log2(1 + input), rounded to nearest
+    constexpr auto operator()(in_t input) const noexcept -> out_t
+    {
+        auto const acc = horner_sequence(input.value, std::make_index_sequence<poly_degree - 1>{});
+
+        // acc is c1 + x(...), which is positive, so the last product is too
+        auto const final_product = static_cast<int128_t>(acc) * static_cast<int128_t>(input.value);
+        auto const final_shift = in_frac_bits + poly_shifts[poly_degree - 1];
+        auto const result = (final_product >> final_shift) + ((final_product >> (final_shift - 1)) & 1);
+
+        return out_t::literal(static_cast<uint64_t>(result));
+    }
+
+    /// \returns log2(input), rounded to nearest, saturated to the output's range
+    ///
+    /// log2(0) is -inf, so it saturates to the output's min.
+    template <signed_integral out_value_t, int out_frac_bits, unsigned_integral in_value_t, int in_frac_bits>
+        requires(sizeof(in_value_t) <= sizeof(uint64_t) && sizeof(out_value_t) <= sizeof(int64_t)
+            && out_frac_bits <= out_t::frac_bits)
+    constexpr auto eval(fixed_t<in_value_t, in_frac_bits> input) const noexcept -> fixed_t<out_value_t, out_frac_bits>
+    {
+        using result_t = fixed_t<out_value_t, out_frac_bits>;
+
+        if (!input.value) [[unlikely]] { return result_t::literal(min<out_value_t>()); }
+
+        // normalize so the leading 1 is in the msb; it is implied, so shift it out, leaving only the fraction
+        auto const value = static_cast<uint64_t>(input.value);
+        auto const leading_zeros = std::countl_zero(value);
+        auto const frac = in_t::literal((value << leading_zeros) << 1);
+        auto const int_part = static_cast<int_t>(63 - leading_zeros) - in_frac_bits;
+
+        // the integer part is exact, so only the kernel's result needs rounding
+        auto const kernel_result = static_cast<int128_t>((*this)(frac).value);
+        auto const shift = out_t::frac_bits - out_frac_bits;
+        auto const frac_part = shift ? (kernel_result >> shift) + ((kernel_result >> (shift - 1)) & 1) : kernel_result;
+
+        auto const result = static_cast<int128_t>(int_part) * (int128_t{1} << out_frac_bits) + frac_part;
+
+        // int_part is at most 64 in magnitude, so only narrow or nearly all-fractional outputs saturate
+        if (result > max<out_value_t>()) [[unlikely]] { return result_t::literal(max<out_value_t>()); }
+        if (result < min<out_value_t>()) [[unlikely]] { return result_t::literal(min<out_value_t>()); }
+        return result_t::literal(static_cast<out_value_t>(result));
+    }
+
+private:
+    /// one Horner step, rounding acc * x from the previous coefficient's format into the next one's
+    template <std::size_t index> static constexpr auto horner_step(int64_t acc, uint64_t x) noexcept -> int64_t
+    {
+        constexpr auto shift = in_frac_bits + poly_shifts[index];
+
+        auto const product = static_cast<int128_t>(acc) * static_cast<int128_t>(x);
+        return static_cast<int64_t>((product >> shift) + ((product >> (shift - 1)) & 1)) + poly_coeffs[index + 1];
+    }
+
+    /// unrolls every step but the last, so each shift is an immediate
+    template <std::size_t... indices>
+    static constexpr auto horner_sequence(uint64_t x, std::index_sequence<indices...>) noexcept -> int64_t
+    {
+        auto acc = poly_coeffs[0];
+
+        // the comma fold sequences the steps in order
+        ((acc = horner_step<indices>(acc, x)), ...);
+
+        return acc;
+    }
+
+    // clang-format off
+    // approx error: 7.0722803973938902e-13
+    static constexpr auto poly_degree = 14;
+    static const int64_t poly_coeffs[];
+    static constexpr int_t poly_shifts[] = {
+        3, // relative shift from x^14 (Q-10.73) to x^13 (Q-7.70)
+        2, // relative shift from x^13 (Q-7.70) to x^12 (Q-5.68)
+        1, // relative shift from x^12 (Q-5.68) to x^11 (Q-4.67)
+        1, // relative shift from x^11 (Q-4.67) to x^10 (Q-3.66)
+        1, // relative shift from x^10 (Q-3.66) to x^9 (Q-2.65)
+        0, // relative shift from x^9 (Q-2.65) to x^8 (Q-2.65)
+        0, // relative shift from x^8 (Q-2.65) to x^7 (Q-2.65)
+        0, // relative shift from x^7 (Q-2.65) to x^6 (Q-2.65)
+        1, // relative shift from x^6 (Q-2.65) to x^5 (Q-1.64)
+        0, // relative shift from x^5 (Q-1.64) to x^4 (Q-1.64)
+        0, // relative shift from x^4 (Q-1.64) to x^3 (Q-1.64)
+        1, // relative shift from x^3 (Q-1.64) to x^2 (Q0.63)
+        1, // relative shift from x^2 (Q0.63) to x^1 (Q1.62)
+        -1, // relative shift from x^1 (Q1.62) to output (Q1.63)
+    };
+    // clang-format on
+};
+
+} // namespace crv
@@ -0,0 +1,162 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "log2.hpp"
+#include <crv/math/fixed/io.hpp>
+#include <crv/test/test.hpp>
+#include <cmath>
+
+namespace crv {
+namespace {
+
+// --------------------------------------------------------------------------------------------------------------------
+// Kernel
+// --------------------------------------------------------------------------------------------------------------------
+
+using in_t = log2_t::in_t;
+using out_t = log2_t::out_t;
+
+struct vector_t
+{
+    in_t input;
+    out_t expected;
+
+    friend auto operator<<(std::ostream& out, vector_t const& src) -> std::ostream&
+    {
+        return out << "{.input = " << src.input.value << ", .expected = " << src.expected.value << "}";
+    }
+};
+
+struct log2_t_kernel_test_t : TestWithParam<vector_t>
+{
+    in_t const& input = GetParam().input;
+    out_t const& expected = GetParam().expected;
+
+    using sut_t = log2_t;
+    sut_t sut{};
+};
+
+TEST_P(log2_t_kernel_test_t, eval)
+{
+    auto const actual = sut(input);
+
+    EXPECT_EQ(expected, actual);
+}
+
+// clang-format off
+vector_t const kernel_vectors[] = {
+    vector_t{in_t::literal(0x0000'0000'0000'0000), out_t::literal(0x0000'0000'0000'0000)}, // log2(1) = 0
+    vector_t{in_t::literal(0x0000'0000'0000'0001), out_t::literal(0x0000'0000'0000'0001)},
+
+    vector_t{in_t::literal(0x3fff'ffff'ffff'ffff), out_t::literal(0x2934'f097'99d9'7407)},
+    vector_t{in_t::literal(0x4000'0000'0000'0000), out_t::literal(0x2934'f097'99d9'7408)}, // log2(1.25) = 0.321928095
+    vector_t{in_t::literal(0x4000'0000'0000'0001), out_t::literal(0x2934'f097'99d9'7409)},
+
+    vector_t{in_t::literal(0x7fff'ffff'ffff'ffff), out_t::literal(0x4ae0'0d1c'fe0a'4e3a)},
+    vector_t{in_t::literal(0x8000'0000'0000'0000), out_t::literal(0x4ae0'0d1c'fe0a'4e3b)}, // log2(1.5) = 0.584962501
+    vector_t{in_t::literal(0x8000'0000'0000'0001), out_t::literal(0x4ae0'0d1c'fe0a'4e3b)},
+
+    vector_t{in_t::literal(0xbfff'ffff'ffff'ffff), out_t::literal(0x6757'67f5'40a4'3646)},
+    vector_t{in_t::literal(0xc000'0000'0000'0000), out_t::literal(0x6757'67f5'40a4'3647)}, // log2(1.75) = 0.807354922
+    vector_t{in_t::literal(0xc000'0000'0000'0001), out_t::literal(0x6757'67f5'40a4'3646)},
+
+    vector_t{in_t::literal(0xffff'ffff'ffff'fffe), out_t::literal(0x7fff'ffff'ffff'ffff)},
+    vector_t{in_t::literal(0xffff'ffff'ffff'ffff), out_t::literal(0x8000'0000'0000'0000)}, // log2(2) = 1
+};
+INSTANTIATE_TEST_SUITE_P(kernel_vectors, log2_t_kernel_test_t, ValuesIn(kernel_vectors));
+// clang-format on
+
+// --------------------------------------------------------------------------------------------------------------------
+// Eval
+// --------------------------------------------------------------------------------------------------------------------
+
+struct log2_t_eval_test_t : Test
+{
+    using in_t = fixed_t<uint64_t, 32>;
+    using out_t = fixed_t<int64_t, 32>;
+
+    static constexpr auto one = int64_t{1} << out_t::frac_bits;
+
+    using sut_t = log2_t;
+    sut_t sut{};
+
+    auto eval(in_t input) const noexcept -> out_t { return sut.eval<int64_t, out_t::frac_bits>(input); }
+};
+
+TEST_F(log2_t_eval_test_t, one)
+{
+    EXPECT_EQ(0, eval(in_t{1}).value);
+}
+
+TEST_F(log2_t_eval_test_t, powers_of_two_are_exact)
+{
+    for (auto exponent = -32; exponent < 32; ++exponent)
+    {
+        auto const input = in_t::literal(uint64_t{1} << (exponent + in_t::frac_bits));
+        EXPECT_EQ(exponent * one, eval(input).value) << "exponent = " << exponent;
+    }
+}
+
+TEST_F(log2_t_eval_test_t, fractions)
+{
+    for (auto const real : {3.0, 0.75, 10.0, 1000.0, 0.001})
+    {
+        // compare against the input as it was actually rounded
+        auto const input = in_t::literal(static_cast<uint64_t>(std::llround(real * (1ull << in_t::frac_bits))));
+        auto const rounded = static_cast<double>(input.value) / (1ull << in_t::frac_bits);
+        auto const expected = static_cast<int64_t>(std::llround(std::log2(rounded) * static_cast<double>(one)));
+
+        EXPECT_NEAR(expected, eval(input).value, 1) << "input = " << real;
+    }
+}
+
+TEST_F(log2_t_eval_test_t, largest)
+{
+    // log2(2^32 - 2^-32) is just below 32
+    EXPECT_EQ(32 * one, eval(in_t::literal(max<uint64_t>())).value);
+}
+
+TEST_F(log2_t_eval_test_t, is_monotonic_across_powers_of_two)
+{
+    for (auto exponent = -8; exponent < 8; ++exponent)
+    {
+        auto const boundary = uint64_t{1} << (exponent + in_t::frac_bits);
+        auto const below = eval(in_t::literal(boundary - 1)).value;
+        auto const at = eval(in_t::literal(boundary)).value;
+        auto const above = eval(in_t::literal(boundary + 1)).value;
+
+        EXPECT_LE(below, at) << "exponent = " << exponent;
+        EXPECT_LE(at, above) << "exponent = " << exponent;
+    }
+}
+
+TEST_F(log2_t_eval_test_t, zero_saturates_to_min)
+{
+    EXPECT_EQ(min<int64_t>(), eval(in_t{0}).value);
+}
+
+TEST_F(log2_t_eval_test_t, narrow_output_saturates)
+{
+    using narrow_t = fixed_t<int8_t, 4>;
+
+    EXPECT_EQ(max<int8_t>(), (sut.eval<int8_t, narrow_t::frac_bits>(in_t{uint64_t{1} << 16})).value);
+    EXPECT_EQ(min<int8_t>(), (sut.eval<int8_t, narrow_t::frac_bits>(in_t::literal(1))).value);
+}
+
+TEST_F(log2_t_eval_test_t, integer_input)
+{
+    using integer_t = fixed_t<uint32_t, 0>;
+
+    EXPECT_EQ(10 * one, (sut.eval<int64_t, out_t::frac_bits>(integer_t{1024})).value);
+}
+
+TEST_F(log2_t_eval_test_t, full_width_output)
+{
+    // 1.5 = 1 + 0.5, so eval at q1.63 is the kernel's own result
+    EXPECT_EQ(0x4ae0'0d1c'fe0a'4e3b, (sut.eval<int64_t, 63>(in_t::literal(3ull << (in_t::frac_bits - 1)))).value);
+}
+
+} // namespace
+} // namespace crv
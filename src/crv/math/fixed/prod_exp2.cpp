@@ -0,0 +1,25 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "prod_exp2.hpp"
+
+namespace crv {
+
+uint64_t const prod_exp2_t::poly_coeffs[] = {
+    11537440551960300955ULL, // 3.640574319101205240776251850228e-11*x^12 (Q-34.98)
+    16315371346723807811ULL, // 4.118578755069920477499786732384e-10*x^11 (Q-31.95)
+    8803244769726808246ULL, // 7.111204493239119437555974860710e-9*x^10 (Q-26.90)
+    15740274446079780537ULL, // 1.017191395161018847171066109299e-7*x^9 (Q-23.87)
+    12781673088677202504ULL, // 1.321594021868069698344582317703e-6*x^8 (Q-19.83)
+    9219698112688771494ULL, // 1.525271106481578236095252108282e-5*x^7 (Q-15.79)
+    11638579090182301805ULL, // 1.540353116970216949133510463218e-4*x^6 (Q-12.76)
+    12593189600950393171ULL, // 1.333355812878152239196411744689e-3*x^5 (Q-9.73)
+    11355082631745621604ULL, // 9.618129107883610984569460122115e-3*x^4 (Q-6.70)
+    8190960700631439760ULL, // 5.550410866479997811258073013018e-2*x^3 (Q-3.67)
+    8862793787191508677ULL, // 2.402265069591016292303369575312e-1*x^2 (Q-1.65)
+    6393154322601327705ULL, // 6.931471805599452958525631591649e-1*x^1 (Q1.63)
+};
+
+} // namespace crv
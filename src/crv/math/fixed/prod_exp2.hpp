@@ -0,0 +1,156 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief production fixed point approximation of 2^x
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/limits.hpp>
+#include <climits>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+namespace crv {
+
+/// 2^x, from one minimax polynomial over [0, 1)
+///
+/// The kernel, operator(), evaluates a degree-12 minimax approximation of 2^x - 1 over [0, 1) with Horner's method,
+/// then adds 1. Each coefficient is stored in the q format that its partial Horner sum needs, so every step keeps 64
+/// significant bits without overflowing, and the shift between consecutive formats is precomputed. The endpoints are
+/// pinned, p(0) = 0 and p(1) = 1, so results stitch together without a seam where eval() carries into the integer part.
+/// The approximation error is below 2^-63, so results are within 2 ulps of 2^x, and monotonic.
+///
+/// eval() reduces any fixed point input to the kernel's domain by splitting off its integer part, which becomes the
+/// final shift, so there is one polynomial for every exponent.
+///
+/// The kernel is one dependent chain of 12 multiply, shift, and add steps, so its latency is fixed by the degree. The
+/// steps are unrolled at compile time, so every shift is an immediate. The budget is latency_budget_cycles;
+/// performance_test_exp2 measures the kernel's latency against it.
+///
+/// Coefficients are generated by tools/gen_poly_coeffs.py prod_exp2.
+class prod_exp2_t
+{
+public:
+    // input:  Q0.64 unsigned — x in [0, 1)
+    // output: Q1.63 unsigned — 2^x in [1, 2)
+    using in_t = fixed_t<uint64_t, 64>;
+    using out_t = fixed_t<uint64_t, 63>;
+
+    static constexpr auto in_frac_bits = in_t::frac_bits;
+    static constexpr auto out_frac_bits = out_t::frac_bits;
+
+    /// cycles one dependent call to the kernel may take: 12 steps at about 7 cycles each, plus the final rounding
+    static constexpr auto latency_budget_cycles = 96;
+
+    static auto prefetch() noexcept -> void
+    {
+        constexpr auto read_only = 0;
+        constexpr auto high_locality = 3; // Keep in L1
+        __builtin_prefetch(poly_coeffs, read_only, high_locality);
+    }
+
+    /// \returns 2^input, rounded to nearest, within 2 ulps
+    constexpr auto operator()(in_t input) const noexcept -> out_t
+    {
+        constexpr auto one = uint128_t{1} << out_frac_bits;
+        constexpr auto saturated = uint128_t{max<uint64_t>()};
+
+        auto const acc = horner_sequence(input.value, std::make_index_sequence<poly_degree - 1>{});
+
+        // the last product keeps all 128 bits until it is rounded into the output
+        auto const final_product = static_cast<uint128_t>(acc) * input.value;
+        auto const final_shift = in_frac_bits + poly_shifts[poly_degree - 1];
+        auto const result = (final_product >> final_shift) + ((final_product >> (final_shift - 1)) & 1) + one;
+
+        // 2^x approaches 2 as x approaches 1, and rounding can reach it, so saturate rather than wrap
+        return out_t::literal(static_cast<uint64_t>(result < saturated ? result : saturated));
+    }
+
+    /// \returns 2^input, rounded to nearest, saturated to the output's range
+    template <unsigned_integral out_value_t, int out_frac_bits, integral in_value_t, int in_frac_bits>
+        requires(sizeof(in_value_t) <= sizeof(uint64_t) && in_frac_bits <= std::numeric_limits<in_value_t>::digits)
+    constexpr auto eval(fixed_t<in_value_t, in_frac_bits> input) const noexcept -> fixed_t<out_value_t, out_frac_bits>
+    {
+        using result_t = fixed_t<out_value_t, out_frac_bits>;
+        constexpr auto out_digits = std::numeric_limits<out_value_t>::digits;
+
+        // split into integer and fractional parts; the integer part is the floor, so the fraction is in [0, 1)
+        //
+        // Shifting by the full width is undefined, but when all bits are fractional, there's no integer part anyway.
+        constexpr auto in_width = static_cast<int>(sizeof(in_value_t) * CHAR_BIT);
+        auto whole = in_value_t{0};
+        if constexpr (in_frac_bits < in_width) whole = input.value >> in_frac_bits;
+
+        auto frac = in_t{};
+        if constexpr (in_frac_bits > 0) frac = in_t::literal(static_cast<uint64_t>(input.value) << (64 - in_frac_bits));
+
+        // 2^whole leaves no room for the kernel's leading 1
+        if (whole >= static_cast<in_value_t>(out_digits - out_frac_bits)) [[unlikely]]
+        {
+            return result_t::literal(max<out_value_t>());
+        }
+
+        // 2^input is below 2^(whole + 1), which is at most half an ulp, so it rounds to 0
+        if constexpr (std::is_signed_v<in_value_t>)
+        {
+            if (whole < -static_cast<in_value_t>(out_frac_bits + 1)) [[unlikely]] { return result_t::literal(0); }
+        }
+
+        auto const int_part = static_cast<int_t>(whole);
+        auto const kernel_result = static_cast<uint128_t>((*this)(frac).value);
+
+        auto const shift = out_frac_bits - out_t::frac_bits + int_part;
+        if (shift >= 0) return result_t::literal(static_cast<out_value_t>(kernel_result << shift));
+
+        auto const shr = -shift;
+        return result_t::literal(static_cast<out_value_t>((kernel_result >> shr) + ((kernel_result >> (shr - 1)) & 1)));
+    }
+
+private:
+    /// one Horner step, rounding acc * x from the previous coefficient's format into the next one's
+    template <std::size_t index> static constexpr auto horner_step(uint64_t acc, uint64_t x) noexcept -> uint64_t
+    {
+        constexpr auto shift = in_frac_bits + poly_shifts[index];
+
+        auto const product = static_cast<uint128_t>(acc) * x;
+        return static_cast<uint64_t>((product >> shift) + ((product >> (shift - 1)) & 1)) + poly_coeffs[index + 1];
+    }
+
+    /// unrolls every step but the last, so each shift is an immediate
+    template <std::size_t... indices>
+    static constexpr auto horner_sequence(uint64_t x, std::index_sequence<indices...>) noexcept -> uint64_t
+    {
+        auto acc = poly_coeffs[0];
+
+        // the comma fold sequences the steps in order
+        ((acc = horner_step<indices>(acc, x)), ...);
+
+        return acc;
+    }
+
+    // clang-format off
+    // approx error: 8.6987555996741286e-20
+    static constexpr auto poly_degree = 12;
+    static const uint64_t poly_coeffs[];
+    static constexpr int_t poly_shifts[] = {
+        3, // relative shift from x^12 (Q-34.98) to x^11 (Q-31.95)
+        5, // relative shift from x^11 (Q-31.95) to x^10 (Q-26.90)
+        3, // relative shift from x^10 (Q-26.90) to x^9 (Q-23.87)
+        4, // relative shift from x^9 (Q-23.87) to x^8 (Q-19.83)
+        4, // relative shift from x^8 (Q-19.83) to x^7 (Q-15.79)
+        3, // relative shift from x^7 (Q-15.79) to x^6 (Q-12.76)
+        3, // relative shift from x^6 (Q-12.76) to x^5 (Q-9.73)
+        3, // relative shift from x^5 (Q-9.73) to x^4 (Q-6.70)
+        3, // relative shift from x^4 (Q-6.70) to x^3 (Q-3.67)
+        2, // relative shift from x^3 (Q-3.67) to x^2 (Q-1.65)
+        2, // relative shift from x^2 (Q-1.65) to x^1 (Q1.63)
+        0, // relative shift from x^1 (Q1.63) to output (Q1.63)
+    };
+    // clang-format on
+};
+
+} // namespace crv
@@ -0,0 +1,159 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "prod_exp2.hpp"
+#include <crv/math/fixed/io.hpp>
+#include <crv/test/test.hpp>
+#include <cmath>
+
+namespace crv {
+namespace {
+
+// --------------------------------------------------------------------------------------------------------------------
+// Kernel
+// --------------------------------------------------------------------------------------------------------------------
+
+using in_t = prod_exp2_t::in_t;
+using out_t = prod_exp2_t::out_t;
+
+struct vector_t
+{
+    in_t input;
+    out_t expected;
+
+    friend auto operator<<(std::ostream& out, vector_t const& src) -> std::ostream&
+    {
+        return out << "{.input = " << src.input.value << ", .expected = " << src.expected.value << "}";
+    }
+};
+
+struct prod_exp2_t_kernel_test_t : TestWithParam<vector_t>
+{
+    in_t const& input = GetParam().input;
+    out_t const& expected = GetParam().expected;
+
+    using sut_t = prod_exp2_t;
+    sut_t sut{};
+};
+
+TEST_P(prod_exp2_t_kernel_test_t, eval)
+{
+    auto const actual = sut(input);
+
+    EXPECT_EQ(expected, actual);
+}
+
+// clang-format off
+vector_t const kernel_vectors[] = {
+    vector_t{in_t::literal(0x0000'0000'0000'0000), out_t::literal(0x8000'0000'0000'0000)}, // 2^0 = 1
+    vector_t{in_t::literal(0x0000'0000'0000'0001), out_t::literal(0x8000'0000'0000'0000)},
+
+    vector_t{in_t::literal(0x3fff'ffff'ffff'ffff), out_t::literal(0x9837'f051'8db8'a96f)},
+    vector_t{in_t::literal(0x4000'0000'0000'0000), out_t::literal(0x9837'f051'8db8'a970)}, // 2^0.25 = 1.189207115
+    vector_t{in_t::literal(0x4000'0000'0000'0001), out_t::literal(0x9837'f051'8db8'a970)},
+
+    vector_t{in_t::literal(0x7fff'ffff'ffff'ffff), out_t::literal(0xb504'f333'f9de'6484)},
+    vector_t{in_t::literal(0x8000'0000'0000'0000), out_t::literal(0xb504'f333'f9de'6485)}, // 2^0.5 = 1.414213562
+    vector_t{in_t::literal(0x8000'0000'0000'0001), out_t::literal(0xb504'f333'f9de'6485)},
+
+    vector_t{in_t::literal(0xbfff'ffff'ffff'ffff), out_t::literal(0xd744'fcca'd69d'6af3)},
+    vector_t{in_t::literal(0xc000'0000'0000'0000), out_t::literal(0xd744'fcca'd69d'6af5)}, // 2^0.75 = 1.681792831
+    vector_t{in_t::literal(0xc000'0000'0000'0001), out_t::literal(0xd744'fcca'd69d'6af5)},
+
+    vector_t{in_t::literal(0xffff'ffff'ffff'fffe), out_t::literal(0xffff'ffff'ffff'ffff)}, // saturates approaching 2
+    vector_t{in_t::literal(0xffff'ffff'ffff'ffff), out_t::literal(0xffff'ffff'ffff'ffff)},
+};
+INSTANTIATE_TEST_SUITE_P(kernel_vectors, prod_exp2_t_kernel_test_t, ValuesIn(kernel_vectors));
+// clang-format on
+
+// --------------------------------------------------------------------------------------------------------------------
+// Eval
+// --------------------------------------------------------------------------------------------------------------------
+
+struct prod_exp2_t_eval_test_t : Test
+{
+    using in_t = fixed_t<int64_t, 32>;
+    using out_t = fixed_t<uint64_t, 32>;
+
+    static constexpr auto one = uint64_t{1} << out_t::frac_bits;
+
+    using sut_t = prod_exp2_t;
+    sut_t sut{};
+
+    auto eval(in_t input) const noexcept -> out_t { return sut.eval<uint64_t, out_t::frac_bits>(input); }
+};
+
+TEST_F(prod_exp2_t_eval_test_t, zero)
+{
+    EXPECT_EQ(one, eval(in_t{0}).value);
+}
+
+TEST_F(prod_exp2_t_eval_test_t, whole_numbers_are_exact)
+{
+    for (auto exponent = -32; exponent < 32; ++exponent)
+    {
+        auto const expected = exponent < 0 ? one >> -exponent : one << exponent;
+        EXPECT_EQ(expected, eval(in_t{exponent}).value) << "exponent = " << exponent;
+    }
+}
+
+TEST_F(prod_exp2_t_eval_test_t, negative_fraction_borrows_from_whole)
+{
+    // -0.5 = -1 + 0.5, so 2^-0.5 = 2^0.5/2
+    auto const expected = static_cast<uint64_t>(std::llround(std::sqrt(0.5) * static_cast<double>(one)));
+
+    EXPECT_EQ(expected, eval(in_t::literal(-(int64_t{1} << (in_t::frac_bits - 1)))).value);
+}
+
+TEST_F(prod_exp2_t_eval_test_t, is_monotonic_across_integers)
+{
+    for (auto exponent = -8; exponent < 8; ++exponent)
+    {
+        auto const boundary = in_t{exponent}.value;
+        auto const below = eval(in_t::literal(boundary - 1)).value;
+        auto const at = eval(in_t::literal(boundary)).value;
+        auto const above = eval(in_t::literal(boundary + 1)).value;
+
+        EXPECT_LE(below, at) << "exponent = " << exponent;
+        EXPECT_LE(at, above) << "exponent = " << exponent;
+    }
+}
+
+TEST_F(prod_exp2_t_eval_test_t, saturates_on_overflow)
+{
+    EXPECT_EQ(max<uint64_t>(), eval(in_t{32}).value);
+    EXPECT_EQ(max<uint64_t>(), eval(in_t{1000}).value);
+    EXPECT_EQ(max<uint64_t>(), eval(in_t::literal(max<int64_t>())).value);
+}
+
+TEST_F(prod_exp2_t_eval_test_t, largest_representable)
+{
+    // 2^(32 - 2^-32) = 2^32 - ln(2) + ..., which fits, just within 1 of the max
+    EXPECT_LT(max<uint64_t>() - one, eval(in_t::literal(in_t{32}.value - 1)).value);
+}
+
+TEST_F(prod_exp2_t_eval_test_t, underflows_to_zero)
+{
+    EXPECT_EQ(0u, eval(in_t{-34}).value);
+    EXPECT_EQ(0u, eval(in_t{-1000}).value);
+    EXPECT_EQ(0u, eval(in_t::literal(min<int64_t>())).value);
+}
+
+TEST_F(prod_exp2_t_eval_test_t, smallest_rounds_up)
+{
+    // 2^-33 is half an ulp of q32.32, so it rounds up to 1 ulp
+    EXPECT_EQ(1u, eval(in_t{-33}).value);
+}
+
+TEST_F(prod_exp2_t_eval_test_t, all_frac_bits)
+{
+    using q0_64_t = fixed_t<uint64_t, 64>;
+
+    EXPECT_EQ(prod_exp2_t::out_t::literal(0xb504'f333'f9de'6485),
+        (sut.eval<uint64_t, 63>(q0_64_t::literal(0x8000'0000'0000'0000))));
+}
+
+} // namespace
+} // namespace crv
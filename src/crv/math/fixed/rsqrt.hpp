@@ -171,6 +171,7 @@ struct normalized_rsqrt_t
 
     using narrow_t = nr_t::value_t;
 
+    static constexpr auto iteration_count = nr_iteration_count;
     static constexpr auto three = nr_t{3};
 
     [[no_unique_address]] initial_guess_t initial_guess{};
@@ -180,21 +181,34 @@ struct normalized_rsqrt_t
     {
         // Newton-Raphson
         auto y = initial_guess(x);
-        for (int_t i = 0; i < nr_iteration_count - 1; ++i)
-        {
-            auto const yy = multiply<shifter>(y, y);
-            auto const xyy = multiply<nr_t, shifter>(x, yy);
-            auto const product = multiply(y, three - xyy);
+        for (int_t i = 0; i < nr_iteration_count - 1; ++i) y = step(x, y, shifter);
 
-            // this cracks the fixed_t to combine the rescale with division by 2 in a single fused shift
-            y = nr_t::literal(int_cast<narrow_t>(shifter.template shr<nr_t::frac_bits + 1>(product.value)));
-        }
+        return final_step(x, y, shifter);
+    }
+
+    /// one narrowing iteration
+    constexpr auto step(in_t x, nr_t y, shifter_t shifter = {}) const noexcept -> nr_t
+    {
+        auto const product = unscaled_step(x, y, shifter);
+
+        // this cracks the fixed_t to combine the rescale with division by 2 in a single fused shift
+        return nr_t::literal(int_cast<narrow_t>(shifter.template shr<nr_t::frac_bits + 1>(product.value)));
+    }
+
+    /// last iteration, which does not narrow at the end
+    constexpr auto final_step(in_t x, nr_t y, shifter_t shifter = {}) const noexcept -> out_t
+    {
+        auto const product = unscaled_step(x, y, shifter);
+        return out_t::literal(shifter.template shr<nr_t::frac_bits + 1>(product.value));
+    }
 
-        // Final iteration does not narrow at the end.
+private:
+    /// y(3 - xy^2), before halving
+    static constexpr auto unscaled_step(in_t x, nr_t y, shifter_t shifter) noexcept
+    {
         auto const yy = multiply<shifter>(y, y);
         auto const xyy = multiply<nr_t, shifter>(x, yy);
-        auto const product = multiply(y, three - xyy);
-        return out_t::literal(shifter.template shr<nr_t::frac_bits + 1>(product.value));
+        return multiply(y, three - xyy);
     }
 };
 
@@ -229,22 +243,38 @@ struct rsqrt_t
 
     [[no_unique_address]] normalized_rsqrt_t normalized_rsqrt{};
 
+    /// x scaled to [0.5, 1.0), and the fractional bits that scaling left it with
+    struct normalized_t
+    {
+        x_norm_t x_norm;
+        int_t x_norm_frac_bits;
+    };
+
     // \pre x > 0
     template <typename shifter_t = shifter_t<>>
     constexpr auto operator()(in_t x, shifter_t shifter = {}) const noexcept -> out_t
     {
         assert(x.value > 0);
 
-        // normalize x to [0.5, 1.0) in the format expected by normalized_rsqrt
+        auto const normalized = normalize(x);
+        return denormalize(normalized_rsqrt(normalized.x_norm), normalized.x_norm_frac_bits, shifter);
+    }
+
+    /// normalizes x to [0.5, 1.0) in the format expected by normalized_rsqrt
+    ///
+    /// \pre x > 0
+    static constexpr auto normalize(in_t x) noexcept -> normalized_t
+    {
         auto const wide_x = int_cast<typename x_norm_t::value_t>(x.value);
         auto const x_norm_shift = std::countl_zero(wide_x);
-        auto const x_norm = x_norm_t::literal(wide_x << x_norm_shift);
-        auto const x_norm_frac_bits = x_norm_shift + x_frac_bits;
-
-        // apply normalized rsqrt
-        auto y = normalized_rsqrt(x_norm);
+        return {x_norm_t::literal(wide_x << x_norm_shift), x_norm_shift + x_frac_bits};
+    }
 
-        // denormalize
+    /// scales normalized_rsqrt's result back to x's range
+    template <typename shifter_t = shifter_t<>>
+    static constexpr auto denormalize(
+        normalized_rsqrt_t::out_t y, int_t x_norm_frac_bits, shifter_t shifter = {}) noexcept -> out_t
+    {
         auto const odd_exponent = (x_norm_frac_bits & 1) != 0;
         if (odd_exponent)
         {
@@ -0,0 +1,34 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief builds the input pipeline's notch from profile config
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/input/notch.hpp>
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/model/config.hpp>
+#include <cmath>
+#include <numbers>
+
+namespace crv::model {
+
+/// converts a notch width to the sine the notch compares against
+///
+/// Width is the fraction of the 45 degrees between each axis and the diagonal that snaps to the axis, so 0 disables
+/// the notch, and 1 snaps all motion to its nearest axis.
+inline auto notch_threshold(float_t width) -> input::notch_t::threshold_t
+{
+    auto const radians = width * std::numbers::pi_v<float_t> / 4;
+    return to_fixed<input::notch_t::threshold_t>(std::sin(radians));
+}
+
+/// \returns notch threshold for profile's notch width
+inline auto notch_threshold(profile_t const& profile) -> input::notch_t::threshold_t
+{
+    return notch_threshold(profile.notch_width.value());
+}
+
+} // namespace crv::model
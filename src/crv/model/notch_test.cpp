@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "notch.hpp"
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/test/test.hpp>
+#include <cmath>
+
+namespace crv::model {
+namespace {
+
+using input::motion_t;
+using input::notch_t;
+using inverse_length_t = fixed_t<uint64_t, 62>;
+
+auto snap(notch_t const& notch, motion_t motion) -> motion_t
+{
+    return notch(motion, to_fixed<inverse_length_t>(1 / std::hypot(float_t(motion.x), float_t(motion.y))));
+}
+
+TEST(model_notch_test, default_config_is_disabled)
+{
+    EXPECT_EQ(notch_t::threshold_t{}, notch_threshold(profile_t{}));
+}
+
+TEST(model_notch_test, width_is_fraction_of_45_degrees)
+{
+    auto sut = notch_t{};
+    sut.threshold(notch_threshold(0.5));
+
+    // 22.5 degrees is the edge; 20 is in, 25 is out
+    EXPECT_EQ((motion_t{1000, 0}), snap(sut, motion_t{1000, 364}));
+    EXPECT_EQ((motion_t{1000, 466}), snap(sut, motion_t{1000, 466}));
+}
+
+TEST(model_notch_test, full_width_snaps_everything)
+{
+    auto sut = notch_t{};
+    sut.threshold(notch_threshold(1.0));
+
+    EXPECT_EQ((motion_t{1000, 0}), snap(sut, motion_t{1000, 999}));
+    EXPECT_EQ((motion_t{0, -1000}), snap(sut, motion_t{-999, -1000}));
+}
+
+TEST(model_notch_test, reads_profile)
+{
+    auto profile = profile_t{};
+    profile.notch_width.value(0.25);
+
+    EXPECT_EQ(notch_threshold(0.25), notch_threshold(profile));
+}
+
+} // namespace
+} // namespace crv::model
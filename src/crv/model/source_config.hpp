@@ -0,0 +1,35 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief builds the settings uploaded for each source device from device and profile config
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+extern "C" {
+#include <crv/input/pipeline.h>
+} // extern "C"
+
+#include <crv/lib.hpp>
+#include <crv/model/config.hpp>
+#include <crv/model/notch.hpp>
+#include <crv/model/transform.hpp>
+#include <cmath>
+
+namespace crv::model {
+
+/// \returns settings for device's sources under profile, ready for spline_upload_t::configure()
+///
+/// profile_t::filter_halflife is in milliseconds.
+inline auto source_config(device_t const& device, profile_t const& profile) -> crv_source_config
+{
+    auto const matrix = transform_matrix(device, profile);
+
+    return crv_source_config{
+        .transform = {.xx = matrix[0][0], .xy = matrix[0][1], .yx = matrix[1][0], .yy = matrix[1][1]},
+        .notch_threshold = notch_threshold(profile).value,
+        .filter_halflife_us = std::llround(profile.filter_halflife.value() * 1000),
+    };
+}
+
+} // namespace crv::model
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "source_config.hpp"
+#include <crv/test/test.hpp>
+
+namespace crv::model {
+namespace {
+
+using input::transform_t;
+
+constexpr auto one = transform_t::coeff_t{1}.value;
+
+TEST(model_source_config_test, default_config_is_identity)
+{
+    auto const sut = source_config(device_t{}, profile_t{});
+
+    EXPECT_EQ(one, sut.transform.xx);
+    EXPECT_EQ(0, sut.transform.xy);
+    EXPECT_EQ(0, sut.transform.yx);
+    EXPECT_EQ(one, sut.transform.yy);
+    EXPECT_EQ(0u, sut.notch_threshold);
+    EXPECT_EQ(2000, sut.filter_halflife_us);
+}
+
+TEST(model_source_config_test, transform_is_row_major)
+{
+    auto device = device_t{};
+    device.rotation.value(90.0);
+    auto profile = profile_t{};
+    profile.anisotropy.value(2.0);
+
+    auto const sut = source_config(device, profile);
+
+    EXPECT_EQ(0, sut.transform.xx);
+    EXPECT_EQ(-one, sut.transform.xy);
+    EXPECT_EQ(2 * one, sut.transform.yx);
+    EXPECT_EQ(0, sut.transform.yy);
+}
+
+TEST(model_source_config_test, filter_halflife_is_in_microseconds)
+{
+    auto profile = profile_t{};
+    profile.filter_halflife.value(0.25);
+
+    EXPECT_EQ(250, source_config(device_t{}, profile).filter_halflife_us);
+}
+
+TEST(model_source_config_test, notch_threshold_is_raw_sine)
+{
+    auto profile = profile_t{};
+    profile.notch_width.value(0.25);
+
+    EXPECT_EQ(notch_threshold(profile).value, source_config(device_t{}, profile).notch_threshold);
+}
+
+} // namespace
+} // namespace crv::model
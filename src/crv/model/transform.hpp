@@ -0,0 +1,45 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief builds the input pipeline's transform from device and profile config
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/input/transform.hpp>
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/model/config.hpp>
+#include <cmath>
+#include <numbers>
+
+namespace crv::model {
+
+/// folds rotation, then anisotropic scaling, into one matrix
+///
+/// Rotation turns motion from +x toward +y by rotation_degrees. Anisotropy then scales y relative to x, so 2 makes
+/// vertical motion twice as fast as horizontal, and 1 is isotropic.
+inline auto transform_matrix(float_t rotation_degrees, float_t anisotropy) -> input::transform_t::matrix_t
+{
+    using coeff_t = input::transform_t::coeff_t;
+
+    auto const radians = rotation_degrees * std::numbers::pi_v<float_t> / 180;
+    auto const cos = std::cos(radians);
+    auto const sin = std::sin(radians);
+
+    auto const coeff = [](float_t value) { return to_fixed<coeff_t>(value).value; };
+
+    // diag(1, anisotropy) * rotation
+    return input::transform_t::matrix_t{{{
+        {coeff(cos), coeff(-sin)},
+        {coeff(anisotropy * sin), coeff(anisotropy * cos)},
+    }}};
+}
+
+/// \returns transform matrix for device's rotation and profile's anisotropy
+inline auto transform_matrix(device_t const& device, profile_t const& profile) -> input::transform_t::matrix_t
+{
+    return transform_matrix(device.rotation.value(), profile.anisotropy.value());
+}
+
+} // namespace crv::model
@@ -0,0 +1,61 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "transform.hpp"
+#include <crv/test/test.hpp>
+
+namespace crv::model {
+namespace {
+
+using input::motion_t;
+using input::transform_t;
+
+constexpr auto one = transform_t::coeff_t{1}.value;
+
+TEST(model_transform_test, default_config_is_identity)
+{
+    EXPECT_EQ(transform_t::identity, transform_matrix(device_t{}, profile_t{}));
+}
+
+TEST(model_transform_test, quarter_turns_are_exact)
+{
+    using matrix_t = transform_t::matrix_t;
+
+    EXPECT_EQ((matrix_t{{{{0, -one}, {one, 0}}}}), transform_matrix(90.0, 1.0));
+    EXPECT_EQ((matrix_t{{{{-one, 0}, {0, -one}}}}), transform_matrix(180.0, 1.0));
+    EXPECT_EQ((matrix_t{{{{0, one}, {-one, 0}}}}), transform_matrix(-90.0, 1.0));
+}
+
+TEST(model_transform_test, rotates_toward_y)
+{
+    auto sut = transform_t{};
+    sut.matrix(transform_matrix(45.0, 1.0));
+
+    EXPECT_EQ((motion_t{71, 71}), sut(motion_t{100, 0}));
+    EXPECT_EQ((motion_t{-71, 71}), sut(motion_t{0, 100}));
+}
+
+TEST(model_transform_test, anisotropy_scales_y_after_rotation)
+{
+    auto sut = transform_t{};
+    sut.matrix(transform_matrix(90.0, 2.0));
+
+    // x rotates onto y, then y doubles
+    EXPECT_EQ((motion_t{0, 200}), sut(motion_t{100, 0}));
+    EXPECT_EQ((motion_t{-100, 0}), sut(motion_t{0, 100}));
+}
+
+TEST(model_transform_test, reads_device_and_profile)
+{
+    auto device = device_t{};
+    auto profile = profile_t{};
+    device.rotation.value(30.0);
+    profile.anisotropy.value(0.5);
+
+    EXPECT_EQ(transform_matrix(30.0, 0.5), transform_matrix(device, profile));
+}
+
+} // namespace
+} // namespace crv::model
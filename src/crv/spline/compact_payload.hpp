@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief variable-size wire format for spline payloads
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/spline/segment_storage.hpp>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace crv::spline {
+
+namespace detail {
+
+constexpr auto align_up(std::size_t offset, std::size_t alignment) noexcept -> std::size_t
+{
+    return (offset + alignment - 1) / alignment * alignment;
+}
+
+} // namespace detail
+
+/// packs and unpacks spline payloads carrying only their used segments and trimmed locator tree
+///
+/// spline_t::payload_t is sized for max_segment_count, more than 10kiB in production, even when the spline only has a
+/// few dozen segments. This format carries the used prefixes:
+///
+///     header_t | segment_locator_t::nodes() | segments[0, segment_count)
+///
+/// Each section starts at the next multiple of its element's alignment. Every offset follows from segment_count alone,
+/// so the format contains no pointers or offsets to relocate, and its total size is known from the header before any
+/// other section is read. unpack() checks the sizes against the buffer before copying anything, then validates the
+/// result the same way as a full payload.
+template <typename t_spline_t> class compact_payload_codec_t
+{
+public:
+    using spline_t = t_spline_t;
+    using payload_t = spline_t::payload_t;
+    using segment_t = spline_t::segment_t;
+    using extended_tangent_t = spline_t::extended_tangent_t;
+    using segment_locator_t = spline_t::segment_locator_t;
+    using node_t = segment_locator_t::node_t;
+    using x_t = spline_t::x_t;
+
+    static constexpr auto max_segment_count = spline_t::max_segment_count;
+
+    // segments are copied as bytes
+    static_assert(std::same_as<typename spline_t::segment_storage_t, segment_storages::packed_t>);
+
+    struct header_t
+    {
+        uint32_t size; ///< total encoded size, including this header
+        int32_t segment_count;
+        x_t x_max;
+        extended_tangent_t extend_final_tangent;
+    };
+
+    /// byte offset of the first node
+    static constexpr auto nodes_offset = detail::align_up(sizeof(header_t), alignof(node_t));
+
+    /// size of the trimmed tree for the given number of segments
+    static constexpr auto nodes_size(int_t segment_count) noexcept -> std::size_t
+    {
+        auto const node_count = segment_locator_t::node_count_at(segment_locator_t::depth_for(segment_count));
+        return static_cast<std::size_t>(node_count) * sizeof(node_t);
+    }
+
+    /// byte offset of the first segment
+    static constexpr auto segments_offset(int_t segment_count) noexcept -> std::size_t
+    {
+        return detail::align_up(nodes_offset + nodes_size(segment_count), alignof(segment_t));
+    }
+
+    /// encoded size of a payload with the given number of segments
+    ///
+    /// \pre 0 < segment_count <= max_segment_count
+    static constexpr auto size(int_t segment_count) noexcept -> std::size_t
+    {
+        return segments_offset(segment_count) + static_cast<std::size_t>(segment_count) * sizeof(segment_t);
+    }
+
+    /// largest possible encoded size
+    static constexpr auto max_size = size(max_segment_count);
+
+    /// encodes payload into dst
+    ///
+    /// \pre payload.segment_locator.is_valid()
+    /// \returns number of bytes written, or 0 if dst is too small
+    static auto pack(payload_t const& payload, std::span<std::byte> dst) noexcept -> std::size_t
+    {
+        auto const& segment_locator = payload.segment_locator;
+        auto const segment_count = segment_locator.segment_count();
+        assert(0 < segment_count && segment_count <= max_segment_count && "compact_payload_codec_t: invalid payload");
+
+        auto const encoded_size = size(segment_count);
+        if (dst.size() < encoded_size) return 0;
+
+        auto const header = header_t{
+            .size = static_cast<uint32_t>(encoded_size),
+            .segment_count = static_cast<int32_t>(segment_count),
+            .x_max = segment_locator.x_max(),
+            .extend_final_tangent = payload.extend_final_tangent,
+        };
+        __builtin_memcpy(dst.data(), &header, sizeof(header));
+
+        auto const nodes = std::as_bytes(segment_locator.nodes());
+        __builtin_memcpy(dst.data() + nodes_offset, nodes.data(), nodes.size());
+
+        __builtin_memcpy(dst.data() + segments_offset(segment_count), payload.segments.data(),
+            static_cast<std::size_t>(segment_count) * sizeof(segment_t));
+
+        return encoded_size;
+    }
+
+    /// decodes src into dst
+    ///
+    /// dst is only meaningful when this returns true. Segments past segment_count are left as they were.
+    ///
+    /// \returns true if src is exactly one well-formed encoding of a valid payload
+    static auto unpack(std::span<std::byte const> src, payload_t& dst) noexcept -> bool
+    {
+        if (src.size() < sizeof(header_t)) return false;
+
+        auto header = header_t{};
+        __builtin_memcpy(&header, src.data(), sizeof(header));
+
+        // sizes must agree before anything past the header is read
+        auto const segment_count = static_cast<int_t>(header.segment_count);
+        if (segment_count <= 0 || max_segment_count < segment_count) return false;
+        if (header.size != size(segment_count) || src.size() != header.size) return false;
+
+        dst.segment_locator
+            = segment_locator_t{src.subspan(nodes_offset, nodes_size(segment_count)), header.x_max, segment_count};
+
+        __builtin_memcpy(dst.segments.data(), src.data() + segments_offset(segment_count),
+            static_cast<std::size_t>(segment_count) * sizeof(segment_t));
+
+        dst.extend_final_tangent = header.extend_final_tangent;
+
+        return dst.segment_locator.is_valid();
+    }
+};
+
+} // namespace crv::spline
@@ -0,0 +1,224 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "compact_payload.hpp"
+#include <crv/spline/segment_locator.hpp>
+#include <crv/spline/spline.hpp>
+#include <crv/test/test.hpp>
+#include <array>
+#include <vector>
+
+namespace crv::spline {
+namespace {
+
+using x_t = int_t;
+using y_t = int_t;
+
+struct alignas(32) segment_t
+{
+    using x_t = x_t;
+    using y_t = y_t;
+
+    y_t base_val;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return base_val + x; }
+    constexpr auto operator==(segment_t const&) const noexcept -> bool = default;
+};
+
+struct extended_tangent_t
+{
+    y_t base_val;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return base_val - x; }
+    constexpr auto operator==(extended_tangent_t const&) const noexcept -> bool = default;
+};
+
+using segment_locator_t = segment_locator_t<x_t, 2>;
+using spline_t = spline_t<segment_t, extended_tangent_t, segment_locator_t>;
+using payload_t = spline_t::payload_t;
+using sut_t = compact_payload_codec_t<spline_t>;
+
+constexpr auto stride = x_t{10};
+
+auto create_payload(int_t segment_count) -> payload_t
+{
+    auto const x_max = segment_count * stride;
+
+    auto keys = std::array<x_t, segment_locator_t::total_key_count>{};
+    for (auto i = 0; i < segment_locator_t::total_key_count; ++i)
+    {
+        keys[i] = i + 1 < segment_count ? (i + 1) * stride : x_max;
+    }
+
+    auto result = payload_t{};
+    result.segment_locator = segment_locator_t{keys, x_max, segment_count};
+    for (auto i = 0; i < segment_count; ++i) result.segments[i] = segment_t{100 * (i + 1)};
+    result.extend_final_tangent = extended_tangent_t{-40};
+    return result;
+}
+
+auto pack(payload_t const& payload) -> std::vector<std::byte>
+{
+    auto result = std::vector<std::byte>(sut_t::max_size);
+    result.resize(sut_t::pack(payload, result));
+    return result;
+}
+
+// ====================================================================================================================
+// sizes
+// ====================================================================================================================
+
+static_assert(sut_t::nodes_offset % alignof(segment_locator_t::node_t) == 0);
+static_assert(sut_t::segments_offset(5) % alignof(segment_t) == 0);
+
+// single segment has no tree
+static_assert(sut_t::size(1) == sut_t::segments_offset(1) + sizeof(segment_t));
+static_assert(sut_t::nodes_size(1) == 0);
+
+// tree grows a level at a time
+static_assert(sut_t::nodes_size(4) == sizeof(segment_locator_t::node_t));
+static_assert(sut_t::nodes_size(5) == 5 * sizeof(segment_locator_t::node_t));
+
+// size grows with segment count, and is always smaller than the full payload
+static_assert(sut_t::size(1) < sut_t::size(2));
+static_assert(sut_t::size(15) < sut_t::size(16));
+static_assert(sut_t::max_size == sut_t::size(segment_locator_t::max_segment_count));
+static_assert(sut_t::max_size < sizeof(payload_t));
+
+// ====================================================================================================================
+// round trip
+// ====================================================================================================================
+
+struct compact_payload_round_trip_test_t : testing::TestWithParam<int_t>
+{
+    int_t segment_count = GetParam();
+    payload_t expected = create_payload(segment_count);
+};
+
+TEST_P(compact_payload_round_trip_test_t, restores_payload)
+{
+    auto const packed = pack(expected);
+    ASSERT_EQ(sut_t::size(segment_count), packed.size());
+
+    auto actual = payload_t{};
+    ASSERT_TRUE(sut_t::unpack(packed, actual));
+
+    auto const& actual_locator = actual.segment_locator;
+    auto const& expected_locator = expected.segment_locator;
+    EXPECT_EQ(expected_locator.segment_count(), actual_locator.segment_count());
+    EXPECT_EQ(expected_locator.x_max(), actual_locator.x_max());
+    EXPECT_EQ(expected_locator.depth(), actual_locator.depth());
+    for (auto x = x_t{0}; x < expected_locator.x_max(); ++x)
+    {
+        EXPECT_EQ(expected_locator.locate(x), actual_locator.locate(x));
+    }
+
+    for (auto i = 0; i < segment_count; ++i) EXPECT_EQ(expected.segments[i], actual.segments[i]);
+    EXPECT_EQ(expected.extend_final_tangent, actual.extend_final_tangent);
+
+    // unpacked payload is usable by spline_t directly
+    auto const spline = spline_t{actual};
+    EXPECT_TRUE(spline.is_valid());
+    EXPECT_EQ(100 + 5, spline(5));
+    EXPECT_EQ(-40 - 1, spline(expected_locator.x_max() + 1));
+}
+
+INSTANTIATE_TEST_SUITE_P(segment_counts, compact_payload_round_trip_test_t,
+    testing::Values(1, 2, 4, 5, 15, segment_locator_t::max_segment_count));
+
+// ====================================================================================================================
+// failure cases
+// ====================================================================================================================
+
+struct compact_payload_test_t : testing::Test
+{
+    static constexpr auto segment_count = 7;
+    payload_t payload = create_payload(segment_count);
+    std::vector<std::byte> packed = pack(payload);
+    payload_t actual{};
+
+    auto header() const -> sut_t::header_t
+    {
+        auto result = sut_t::header_t{};
+        __builtin_memcpy(&result, packed.data(), sizeof(result));
+        return result;
+    }
+
+    auto header(sut_t::header_t const& header) -> void { __builtin_memcpy(packed.data(), &header, sizeof(header)); }
+};
+
+TEST_F(compact_payload_test_t, baseline)
+{
+    EXPECT_TRUE(sut_t::unpack(packed, actual));
+}
+
+TEST_F(compact_payload_test_t, pack_rejects_small_buffer)
+{
+    auto buffer = std::vector<std::byte>(sut_t::size(segment_count) - 1);
+    EXPECT_EQ(0u, sut_t::pack(payload, buffer));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_truncated_header)
+{
+    EXPECT_FALSE(sut_t::unpack(std::span{packed}.first(sizeof(sut_t::header_t) - 1), actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_truncated_body)
+{
+    EXPECT_FALSE(sut_t::unpack(std::span{packed}.first(packed.size() - 1), actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_trailing_bytes)
+{
+    packed.push_back(std::byte{0});
+    EXPECT_FALSE(sut_t::unpack(packed, actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_zero_segments)
+{
+    auto modified = header();
+    modified.segment_count = 0;
+    header(modified);
+    EXPECT_FALSE(sut_t::unpack(packed, actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_too_many_segments)
+{
+    auto modified = header();
+    modified.segment_count = segment_locator_t::max_segment_count + 1;
+    header(modified);
+    EXPECT_FALSE(sut_t::unpack(packed, actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_mismatched_size)
+{
+    // a different segment count implies a different size
+    auto modified = header();
+    modified.segment_count = segment_count + 1;
+    header(modified);
+    EXPECT_FALSE(sut_t::unpack(packed, actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_invalid_x_max)
+{
+    auto modified = header();
+    modified.x_max = 0;
+    header(modified);
+    EXPECT_FALSE(sut_t::unpack(packed, actual));
+}
+
+TEST_F(compact_payload_test_t, unpack_rejects_unsorted_keys)
+{
+    // swap the first two keys of the root
+    auto keys = segment_locator_t::node_keys_t{};
+    __builtin_memcpy(&keys, packed.data() + sut_t::nodes_offset, sizeof(keys));
+    std::swap(keys[0], keys[1]);
+    __builtin_memcpy(packed.data() + sut_t::nodes_offset, &keys, sizeof(keys));
+
+    EXPECT_FALSE(sut_t::unpack(packed, actual));
+}
+
+} // namespace
+} // namespace crv::spline
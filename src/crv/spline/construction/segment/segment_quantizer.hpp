@@ -8,6 +8,7 @@
 
 #include <crv/lib.hpp>
 #include <crv/bit.hpp>
+#include <crv/math/abs.hpp>
 #include <crv/math/float_extraction.hpp>
 #include <crv/math/polynomial.hpp>
 #include <crv/math/shifter.hpp>
@@ -62,6 +63,13 @@ struct segment_quantizer_t
 
     static constexpr auto max_intermediate_shift = t_max_intermediate_shift;
 
+    /// leading terms are dropped while their combined magnitude stays below this: a quarter of an output ulp
+    ///
+    /// t is in [0, 1) across the segment, so a term's coefficient bounds its contribution anywhere on it. Dropping
+    /// terms this small moves the output by at most one rounding step, and lets the evaluator skip their steps.
+    static constexpr auto negligible_magnitude = scalar_t{1} / static_cast<scalar_t>(int64_t{1} << (out_frac_bits + 2));
+    static_assert(out_frac_bits + 2 < 63);
+
     // prevent left shifts during evaluation
     //
     // This is the base amount shifted right after every iteration of the evaluation loop. If this is negative, the loop
@@ -73,13 +81,16 @@ struct segment_quantizer_t
     [[no_unique_address]] mantissa_quantizer_t quantize_mantissa;
     [[no_unique_address]] radix_aligner_t align_radix;
 
-    constexpr auto operator()(cubic_t const& cubic, int_t log2_width) const noexcept -> unpacked_segment_t
+    constexpr auto operator()(cubic_t const& original_cubic, int_t log2_width) const noexcept -> unpacked_segment_t
     {
         assert(log2_width >= log2_min_width);
         auto const t_to_x_shift = in_frac_bits + log2_width;
 
         auto unpacked = unpacked_segment_t{};
 
+        // plateaus fit as cubics with vanishing leading terms; zeroing them encodes a lower-degree segment
+        auto const cubic = reduce_degree(original_cubic);
+
         // extract initial accumulator
         auto next_term = extract_float(cubic[0]);
         auto accumulator_mantissa = int_cast<mantissa_t>(next_term.mantissa);
@@ -146,6 +157,20 @@ struct segment_quantizer_t
 
         return unpacked;
     }
+
+private:
+    /// zeros leading terms too small to affect the output
+    static constexpr auto reduce_degree(cubic_t cubic) noexcept -> cubic_t
+    {
+        auto dropped_magnitude = scalar_t{0};
+        for (auto term_index = 0; term_index < fields_per_segment - 1; ++term_index)
+        {
+            dropped_magnitude += abs(cubic[term_index]);
+            if (dropped_magnitude >= negligible_magnitude) break;
+            cubic[term_index] = 0;
+        }
+        return cubic;
+    }
 };
 
 } // namespace crv::spline
@@ -241,6 +241,18 @@ static_assert(sut({0.0, 0.0, 0.0, 0.125}, 0)
         unpacked_field_t{.mantissa = 4503599627370496, .shift = 30},
     });
 
+// drop negligible first term
+//
+// out_frac_bits is 25, so terms are negligible while their combined magnitude is below 2^-27, about 7.5e-9.
+static_assert(sut({1e-12, 0.5, 0.25, 0.125}, 0) == sut({0.0, 0.5, 0.25, 0.125}, 0));
+
+// drop negligible first three terms
+static_assert(sut({1e-9, -1e-9, 1e-9, 0.125}, 0) == sut({0.0, 0.0, 0.0, 0.125}, 0));
+
+// keep a term once the combined magnitude is no longer negligible, even though the term alone is
+static_assert(sut({4e-9, 4e-9, 0.25, 0.125}, 0)[0].mantissa == 0);
+static_assert(sut({4e-9, 4e-9, 0.25, 0.125}, 0)[1].mantissa != 0);
+
 // destructive flushing
 //
 // c2 is so small relative to c3 that the required destructive preshift exceeds the 64-bit container size, causing it to
@@ -10,6 +10,7 @@
 #include <crv/math/fixed/fixed.hpp>
 #include <crv/math/fixed/float_conversions.hpp>
 #include <algorithm>
+#include <array>
 #include <iterator>
 
 namespace crv::spline {
@@ -4,6 +4,7 @@
 /// \copyright Copyright (C) 2026 Frank Secilia
 
 #include "assembler.hpp"
+#include <crv/spline/dyadic_segment_locator.hpp>
 #include <crv/test/test.hpp>
 #include <array>
 #include <gmock/gmock.h>
@@ -224,6 +225,50 @@ TEST(spline_assembler_test, vs_real_dependencies)
     EXPECT_EQ(spline.payload.segments[1].payload_id, spline.payload.extend_final_tangent);
 }
 
+// the assembler only needs the locator's key count and constructor, so the dyadic locator drops in
+TEST(spline_assembler_test, dyadic_segment_locator)
+{
+    using dyadic_segment_locator_t = dyadic_segment_locator_t<x_t, 3, -1, 7, 2>;
+
+    struct dyadic_spline_t
+    {
+        using segment_locator_t = dyadic_segment_locator_t;
+        static constexpr auto max_segment_count = segment_locator_t::max_segment_count;
+
+        struct payload_t
+        {
+            std::array<segment_t, max_segment_count> segments{};
+            segment_locator_t segment_locator{};
+            int_t extend_final_tangent{};
+        };
+        payload_t payload;
+    };
+
+    auto workspace = workspace_t{};
+    auto state = typestate_t{workspace};
+    state.workspace.completed_intervals = {
+        {.subdomain = {.left = {.x = 20.0}}, .segment = {.payload_id = 73}},
+        {.subdomain = {.left = {.x = 0.0}}, .segment = {.payload_id = 37}},
+        {.subdomain = {.left = {.x = 10.0}}, .segment = {.payload_id = 42}},
+    };
+
+    auto spline = dyadic_spline_t{};
+
+    using sut_t = assembler_t<typestate_t, interval_t, interval_sorter_t, interval_unzipper_t, key_padder_t,
+        tangent_extender_t, 100>;
+    sut_t{}(std::move(state), spline);
+
+    auto const& locator = spline.payload.segment_locator;
+    ASSERT_TRUE(locator.is_valid());
+    EXPECT_EQ(locator.segment_count(), 3);
+    EXPECT_EQ(locator.x_max(), to_fixed<x_t>(100.0));
+
+    using result_t = dyadic_segment_locator_t::result_t;
+    EXPECT_EQ((result_t{0, to_fixed<x_t>(0.0)}), locator.locate(to_fixed<x_t>(9.5)));
+    EXPECT_EQ((result_t{1, to_fixed<x_t>(10.0)}), locator.locate(to_fixed<x_t>(10.0)));
+    EXPECT_EQ((result_t{2, to_fixed<x_t>(20.0)}), locator.locate(to_fixed<x_t>(99.0)));
+}
+
 //
 // parameterized tests
 //
@@ -0,0 +1,294 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief wire format for updating a spline payload in place from the difference between two payloads
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/spline/compact_payload.hpp>
+#include <crv/spline/segment_storage.hpp>
+#include <cassert>
+#include <concepts>
+#include <cstddef>
+#include <span>
+
+namespace crv::spline {
+
+/// encodes the difference between two payloads, and applies it to a copy of the first to produce the second
+///
+/// Dragging a single parameter regenerates the whole spline, but usually only moves part of it, so most of a compact
+/// payload is the same from one update to the next. This format carries only the runs of locator nodes and segments
+/// that changed, plus the locator's extent and the tangent extension, which are small enough to always send:
+///
+///     header_t | run_t[node_run_count] | run_t[segment_run_count] | node runs' nodes | segment runs' segments
+///
+/// Runs are ascending, disjoint, and nonempty. Each data section starts at the next multiple of its element's
+/// alignment, and all offsets follow from the header and runs, so apply() checks every run and the total size against
+/// the buffer before writing anything, then validates the result the same way as a full payload.
+///
+/// A delta is only meaningful applied to the base it was taken against. When the destination is a double buffer's
+/// staged slot, that slot holds the value from before the last commit, not the published one, so the caller must
+/// bring it up to date first, e.g. by applying the previous delta to it as well.
+template <typename t_spline_t> class delta_payload_codec_t
+{
+public:
+    using spline_t = t_spline_t;
+    using payload_t = spline_t::payload_t;
+    using segment_t = spline_t::segment_t;
+    using extended_tangent_t = spline_t::extended_tangent_t;
+    using segment_locator_t = spline_t::segment_locator_t;
+    using node_t = segment_locator_t::node_t;
+    using x_t = spline_t::x_t;
+
+    static constexpr auto max_segment_count = spline_t::max_segment_count;
+    static constexpr auto max_node_count = segment_locator_t::node_count;
+
+    // segments are compared and copied as bytes
+    static_assert(std::same_as<typename spline_t::segment_storage_t, segment_storages::packed_t>);
+
+    struct header_t
+    {
+        uint32_t size; ///< total encoded size, including this header
+        int32_t segment_count;
+        x_t x_max;
+        uint32_t node_run_count;
+        uint32_t segment_run_count;
+        extended_tangent_t extend_final_tangent;
+    };
+
+    /// consecutive elements that changed
+    struct run_t
+    {
+        uint32_t first;
+        uint32_t count;
+    };
+
+    /// byte offset of the first run
+    static constexpr auto runs_offset = detail::align_up(sizeof(header_t), alignof(run_t));
+
+    /// byte offset of the first node
+    static constexpr auto nodes_offset(std::size_t run_count) noexcept -> std::size_t
+    {
+        return detail::align_up(runs_offset + run_count * sizeof(run_t), alignof(node_t));
+    }
+
+    /// byte offset of the first segment
+    static constexpr auto segments_offset(std::size_t run_count, std::size_t node_count) noexcept -> std::size_t
+    {
+        return detail::align_up(nodes_offset(run_count) + node_count * sizeof(node_t), alignof(segment_t));
+    }
+
+    /// encoded size of a delta with the given numbers of runs and changed elements
+    static constexpr auto size(std::size_t run_count, std::size_t node_count, std::size_t segment_count) noexcept
+        -> std::size_t
+    {
+        return segments_offset(run_count, node_count) + segment_count * sizeof(segment_t);
+    }
+
+    /// largest possible encoded size; every element changed, and each is its own run
+    static constexpr auto max_size = size(max_node_count + max_segment_count, max_node_count, max_segment_count);
+
+    /// encodes the changes from base to target into dst
+    ///
+    /// \pre base.segment_locator.is_valid() && target.segment_locator.is_valid()
+    /// \returns number of bytes written, or 0 if dst is too small
+    static auto diff(payload_t const& base, payload_t const& target, std::span<std::byte> dst) noexcept -> std::size_t
+    {
+        auto const& segment_locator = target.segment_locator;
+        auto const segment_count = segment_locator.segment_count();
+        assert(0 < segment_count && segment_count <= max_segment_count && "delta_payload_codec_t: invalid payload");
+
+        auto const base_nodes = base.segment_locator.nodes();
+        auto const target_nodes = segment_locator.nodes();
+        auto const base_segments = segments(base);
+        auto const target_segments = segments(target);
+
+        // first pass sizes the sections
+        auto node_runs = counts_t{};
+        for_each_run(base_nodes, target_nodes, node_runs);
+        auto segment_runs = counts_t{};
+        for_each_run(base_segments, target_segments, segment_runs);
+
+        auto const run_count = node_runs.run_count + segment_runs.run_count;
+        auto const encoded_size = size(run_count, node_runs.element_count, segment_runs.element_count);
+        if (dst.size() < encoded_size) return 0;
+
+        auto const header = header_t{
+            .size = static_cast<uint32_t>(encoded_size),
+            .segment_count = static_cast<int32_t>(segment_count),
+            .x_max = segment_locator.x_max(),
+            .node_run_count = static_cast<uint32_t>(node_runs.run_count),
+            .segment_run_count = static_cast<uint32_t>(segment_runs.run_count),
+            .extend_final_tangent = target.extend_final_tangent,
+        };
+        __builtin_memcpy(dst.data(), &header, sizeof(header));
+
+        // second pass writes them
+        auto node_writer = writer_t<node_t>{
+            .runs = dst.data() + runs_offset,
+            .elements = dst.data() + nodes_offset(run_count),
+            .source = target_nodes,
+        };
+        for_each_run(base_nodes, target_nodes, node_writer);
+
+        auto segment_writer = writer_t<segment_t>{
+            .runs = node_writer.runs,
+            .elements = dst.data() + segments_offset(run_count, node_runs.element_count),
+            .source = target_segments,
+        };
+        for_each_run(base_segments, target_segments, segment_writer);
+
+        return encoded_size;
+    }
+
+    /// applies src to dst in place
+    ///
+    /// dst is only meaningful when this returns true. If the encoding is malformed, dst is untouched, but if the
+    /// resulting payload is invalid, dst has been partially updated and must be replaced before it is published.
+    ///
+    /// \pre dst holds the base src was taken against
+    /// \returns true if src is exactly one well-formed encoding and the updated payload is valid
+    static auto apply(std::span<std::byte const> src, payload_t& dst) noexcept -> bool
+    {
+        if (src.size() < sizeof(header_t)) return false;
+
+        auto header = header_t{};
+        __builtin_memcpy(&header, src.data(), sizeof(header));
+
+        auto const segment_count = static_cast<int_t>(header.segment_count);
+        if (segment_count <= 0 || max_segment_count < segment_count) return false;
+
+        // disjoint, nonempty runs can't outnumber their elements; this also keeps run_count from overflowing
+        auto const node_count = segment_locator_t::node_count_at(segment_locator_t::depth_for(segment_count));
+        if (node_count < static_cast<int_t>(header.node_run_count)) return false;
+        if (segment_count < static_cast<int_t>(header.segment_run_count)) return false;
+
+        auto const run_count = std::size_t{header.node_run_count} + header.segment_run_count;
+        if (src.size() < runs_offset + run_count * sizeof(run_t)) return false;
+
+        // runs must agree with the header and the buffer size before any element is read or written
+        auto const node_runs = src.subspan(runs_offset, header.node_run_count * sizeof(run_t));
+        auto const segment_runs = src.subspan(runs_offset + node_runs.size(), header.segment_run_count * sizeof(run_t));
+        auto const changed_node_count = count_elements(node_runs, node_count);
+        auto const changed_segment_count = count_elements(segment_runs, segment_count);
+        if (changed_node_count < 0 || changed_segment_count < 0) return false;
+
+        auto const encoded_size = size(run_count, static_cast<std::size_t>(changed_node_count),
+            static_cast<std::size_t>(changed_segment_count));
+        if (header.size != encoded_size || src.size() != header.size) return false;
+
+        // apply
+        auto& segment_locator = dst.segment_locator;
+        segment_locator.reshape(header.x_max, segment_count);
+        auto nodes = src.subspan(nodes_offset(run_count));
+        for_each_encoded_run(node_runs, [&](run_t run) noexcept {
+            auto const run_size = run.count * sizeof(node_t);
+            segment_locator.overwrite_nodes(static_cast<int_t>(run.first), nodes.first(run_size));
+            nodes = nodes.subspan(run_size);
+        });
+
+        auto segments = src.subspan(segments_offset(run_count, static_cast<std::size_t>(changed_node_count)));
+        for_each_encoded_run(segment_runs, [&](run_t run) noexcept {
+            auto const run_size = run.count * sizeof(segment_t);
+            __builtin_memcpy(dst.segments.data() + run.first, segments.data(), run_size);
+            segments = segments.subspan(run_size);
+        });
+
+        dst.extend_final_tangent = header.extend_final_tangent;
+
+        return segment_locator.is_valid();
+    }
+
+private:
+    static auto segments(payload_t const& payload) noexcept -> std::span<segment_t const>
+    {
+        return std::span{payload.segments}.first(static_cast<std::size_t>(payload.segment_locator.segment_count()));
+    }
+
+    /// calls visitor with each run of target elements that differ from base
+    ///
+    /// Elements past the end of base have nothing to compare against, so they always differ.
+    template <typename element_t, typename visitor_t>
+    static auto for_each_run(
+        std::span<element_t const> base, std::span<element_t const> target, visitor_t& visitor) noexcept -> void
+    {
+        auto const differs = [&](std::size_t index) noexcept {
+            return base.size() <= index || __builtin_memcmp(&base[index], &target[index], sizeof(element_t)) != 0;
+        };
+
+        for (auto index = std::size_t{0}; index < target.size();)
+        {
+            if (!differs(index))
+            {
+                ++index;
+                continue;
+            }
+
+            auto const first = index;
+            do ++index;
+            while (index < target.size() && differs(index));
+
+            visitor(run_t{static_cast<uint32_t>(first), static_cast<uint32_t>(index - first)});
+        }
+    }
+
+    struct counts_t
+    {
+        std::size_t run_count = 0;
+        std::size_t element_count = 0;
+
+        auto operator()(run_t run) noexcept -> void
+        {
+            ++run_count;
+            element_count += run.count;
+        }
+    };
+
+    template <typename element_t> struct writer_t
+    {
+        std::byte* runs;
+        std::byte* elements;
+        std::span<element_t const> source;
+
+        auto operator()(run_t run) noexcept -> void
+        {
+            __builtin_memcpy(runs, &run, sizeof(run));
+            runs += sizeof(run);
+
+            auto const run_size = run.count * sizeof(element_t);
+            __builtin_memcpy(elements, source.data() + run.first, run_size);
+            elements += run_size;
+        }
+    };
+
+    template <typename visitor_t>
+    static auto for_each_encoded_run(std::span<std::byte const> runs, visitor_t&& visitor) noexcept -> void
+    {
+        for (auto offset = std::size_t{0}; offset < runs.size(); offset += sizeof(run_t))
+        {
+            auto run = run_t{};
+            __builtin_memcpy(&run, runs.data() + offset, sizeof(run));
+            visitor(run);
+        }
+    }
+
+    /// total elements covered by runs, or -1 if they are not ascending, disjoint, nonempty, and within element_count
+    static auto count_elements(std::span<std::byte const> runs, int_t element_count) noexcept -> int_t
+    {
+        auto end = int_t{0};
+        auto total = int_t{0};
+        auto is_well_formed = true;
+        for_each_encoded_run(runs, [&](run_t run) noexcept {
+            auto const first = static_cast<int_t>(run.first);
+            auto const count = static_cast<int_t>(run.count);
+            if (first < end || count == 0 || element_count - first < count) is_well_formed = false;
+            end = first + count;
+            total += count;
+        });
+        return is_well_formed ? total : -1;
+    }
+};
+
+} // namespace crv::spline
@@ -0,0 +1,330 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "delta_payload.hpp"
+#include <crv/spline/segment_locator.hpp>
+#include <crv/spline/spline.hpp>
+#include <crv/test/test.hpp>
+#include <array>
+#include <utility>
+#include <vector>
+
+namespace crv::spline {
+namespace {
+
+using x_t = int_t;
+using y_t = int_t;
+
+struct alignas(32) segment_t
+{
+    using x_t = x_t;
+    using y_t = y_t;
+
+    y_t base_val;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return base_val + x; }
+    constexpr auto operator==(segment_t const&) const noexcept -> bool = default;
+};
+
+struct extended_tangent_t
+{
+    y_t base_val;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return base_val - x; }
+    constexpr auto operator==(extended_tangent_t const&) const noexcept -> bool = default;
+};
+
+using segment_locator_t = segment_locator_t<x_t, 2>;
+using spline_t = spline_t<segment_t, extended_tangent_t, segment_locator_t>;
+using payload_t = spline_t::payload_t;
+using node_t = segment_locator_t::node_t;
+using sut_t = delta_payload_codec_t<spline_t>;
+
+auto create_payload(int_t segment_count, x_t stride = 10) -> payload_t
+{
+    auto const x_max = segment_count * stride;
+
+    auto keys = std::array<x_t, segment_locator_t::total_key_count>{};
+    for (auto i = 0; i < segment_locator_t::total_key_count; ++i)
+    {
+        keys[i] = i + 1 < segment_count ? (i + 1) * stride : x_max;
+    }
+
+    auto result = payload_t{};
+    result.segment_locator = segment_locator_t{keys, x_max, segment_count};
+    for (auto i = 0; i < segment_count; ++i) result.segments[i] = segment_t{100 * (i + 1)};
+    result.extend_final_tangent = extended_tangent_t{-40};
+    return result;
+}
+
+auto diff(payload_t const& base, payload_t const& target) -> std::vector<std::byte>
+{
+    auto result = std::vector<std::byte>(sut_t::max_size);
+    result.resize(sut_t::diff(base, target, result));
+    return result;
+}
+
+auto header(std::vector<std::byte> const& delta) -> sut_t::header_t
+{
+    auto result = sut_t::header_t{};
+    __builtin_memcpy(&result, delta.data(), sizeof(result));
+    return result;
+}
+
+// ====================================================================================================================
+// sizes
+// ====================================================================================================================
+
+static_assert(sut_t::runs_offset % alignof(sut_t::run_t) == 0);
+static_assert(sut_t::nodes_offset(3) % alignof(node_t) == 0);
+static_assert(sut_t::segments_offset(3, 5) % alignof(segment_t) == 0);
+
+// an empty delta is just its header
+static_assert(sut_t::size(0, 0, 0) == sizeof(sut_t::header_t));
+
+// each run and element adds to the size
+static_assert(sut_t::size(0, 0, 0) < sut_t::size(1, 0, 1));
+static_assert(sut_t::size(1, 0, 1) < sut_t::size(2, 0, 2));
+static_assert(sut_t::size(1, 0, 1) < sut_t::size(2, 1, 1));
+
+static_assert(sut_t::max_size
+              == sut_t::size(segment_locator_t::node_count + segment_locator_t::max_segment_count,
+                  segment_locator_t::node_count, segment_locator_t::max_segment_count));
+
+// ====================================================================================================================
+// round trip
+// ====================================================================================================================
+
+auto expect_payload_eq(payload_t const& expected, payload_t const& actual) -> void
+{
+    auto const& actual_locator = actual.segment_locator;
+    auto const& expected_locator = expected.segment_locator;
+    EXPECT_EQ(expected_locator.segment_count(), actual_locator.segment_count());
+    EXPECT_EQ(expected_locator.x_max(), actual_locator.x_max());
+    EXPECT_EQ(expected_locator.depth(), actual_locator.depth());
+    for (auto x = x_t{0}; x < expected_locator.x_max(); ++x)
+    {
+        EXPECT_EQ(expected_locator.locate(x), actual_locator.locate(x));
+    }
+
+    for (auto i = 0; i < expected_locator.segment_count(); ++i) EXPECT_EQ(expected.segments[i], actual.segments[i]);
+    EXPECT_EQ(expected.extend_final_tangent, actual.extend_final_tangent);
+}
+
+TEST(delta_payload_test, unchanged_payload_has_no_runs)
+{
+    auto const payload = create_payload(7);
+    auto const delta = diff(payload, payload);
+
+    EXPECT_EQ(sut_t::size(0, 0, 0), delta.size());
+    EXPECT_EQ(0u, header(delta).node_run_count);
+    EXPECT_EQ(0u, header(delta).segment_run_count);
+
+    auto actual = payload;
+    ASSERT_TRUE(sut_t::apply(delta, actual));
+    expect_payload_eq(payload, actual);
+}
+
+TEST(delta_payload_test, carries_only_changed_segments)
+{
+    auto const base = create_payload(16);
+    auto target = base;
+    target.segments[3] = segment_t{-3};
+    target.segments[4] = segment_t{-4};
+    target.segments[9] = segment_t{-9};
+    target.extend_final_tangent = extended_tangent_t{-50};
+
+    auto const delta = diff(base, target);
+    EXPECT_EQ(sut_t::size(2, 0, 3), delta.size());
+    EXPECT_EQ(0u, header(delta).node_run_count);
+    EXPECT_EQ(2u, header(delta).segment_run_count);
+
+    auto actual = base;
+    ASSERT_TRUE(sut_t::apply(delta, actual));
+    expect_payload_eq(target, actual);
+}
+
+TEST(delta_payload_test, carries_only_changed_nodes)
+{
+    // moving one key touches one node
+    auto const base = create_payload(16);
+    auto keys = std::array<x_t, segment_locator_t::total_key_count>{};
+    for (auto i = 0; i < segment_locator_t::total_key_count; ++i) keys[i] = i + 1 < 16 ? (i + 1) * 10 : 160;
+    keys[0] = 5;
+
+    auto target = base;
+    target.segment_locator = segment_locator_t{keys, 160, 16};
+
+    auto const delta = diff(base, target);
+    EXPECT_EQ(sut_t::size(1, 1, 0), delta.size());
+
+    auto actual = base;
+    ASSERT_TRUE(sut_t::apply(delta, actual));
+    expect_payload_eq(target, actual);
+}
+
+struct delta_payload_round_trip_test_t : testing::TestWithParam<std::pair<int_t, int_t>>
+{
+    payload_t base = create_payload(GetParam().first);
+    payload_t target = create_payload(GetParam().second, 7);
+};
+
+TEST_P(delta_payload_round_trip_test_t, restores_target)
+{
+    auto const delta = diff(base, target);
+    ASSERT_EQ(header(delta).size, delta.size());
+
+    auto actual = base;
+    ASSERT_TRUE(sut_t::apply(delta, actual));
+    expect_payload_eq(target, actual);
+}
+
+INSTANTIATE_TEST_SUITE_P(grow_and_shrink, delta_payload_round_trip_test_t,
+    testing::Values(std::pair{1, 1}, std::pair{1, 16}, std::pair{16, 1}, std::pair{4, 5}, std::pair{5, 4},
+        std::pair{7, 7}, std::pair{16, 16}));
+
+// ====================================================================================================================
+// failure cases
+// ====================================================================================================================
+
+struct delta_payload_test_t : testing::Test
+{
+    static constexpr auto segment_count = 7;
+    payload_t base = create_payload(segment_count);
+    payload_t target = [this] {
+        auto result = base;
+        result.segments[2] = segment_t{-2};
+        result.segments[5] = segment_t{-5};
+        return result;
+    }();
+    std::vector<std::byte> delta = diff(base, target);
+    payload_t actual = base;
+
+    auto header() const -> sut_t::header_t { return crv::spline::header(delta); }
+    auto header(sut_t::header_t const& header) -> void { __builtin_memcpy(delta.data(), &header, sizeof(header)); }
+
+    auto segment_run(std::size_t index) const -> sut_t::run_t
+    {
+        auto result = sut_t::run_t{};
+        __builtin_memcpy(&result, delta.data() + sut_t::runs_offset + index * sizeof(result), sizeof(result));
+        return result;
+    }
+
+    auto segment_run(std::size_t index, sut_t::run_t run) -> void
+    {
+        __builtin_memcpy(delta.data() + sut_t::runs_offset + index * sizeof(run), &run, sizeof(run));
+    }
+
+    auto expect_rejected_untouched() -> void
+    {
+        EXPECT_FALSE(sut_t::apply(delta, actual));
+        expect_payload_eq(base, actual);
+    }
+};
+
+TEST_F(delta_payload_test_t, baseline)
+{
+    ASSERT_EQ(2u, header().segment_run_count);
+    EXPECT_TRUE(sut_t::apply(delta, actual));
+}
+
+TEST_F(delta_payload_test_t, diff_rejects_small_buffer)
+{
+    auto buffer = std::vector<std::byte>(delta.size() - 1);
+    EXPECT_EQ(0u, sut_t::diff(base, target, buffer));
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_truncated_header)
+{
+    EXPECT_FALSE(sut_t::apply(std::span{delta}.first(sizeof(sut_t::header_t) - 1), actual));
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_truncated_body)
+{
+    delta.pop_back();
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_trailing_bytes)
+{
+    delta.push_back(std::byte{0});
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_zero_segments)
+{
+    auto modified = header();
+    modified.segment_count = 0;
+    header(modified);
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_too_many_segments)
+{
+    auto modified = header();
+    modified.segment_count = segment_locator_t::max_segment_count + 1;
+    header(modified);
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_too_many_runs)
+{
+    auto modified = header();
+    modified.segment_run_count = segment_count + 1;
+    header(modified);
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_mismatched_run_count)
+{
+    // one fewer run implies a different size
+    auto modified = header();
+    modified.segment_run_count = 1;
+    header(modified);
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_empty_run)
+{
+    segment_run(0, {.first = 2, .count = 0});
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_overlapping_runs)
+{
+    segment_run(1, {.first = 2, .count = 1});
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_descending_runs)
+{
+    auto const first = segment_run(0);
+    segment_run(0, segment_run(1));
+    segment_run(1, first);
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_run_past_segment_count)
+{
+    segment_run(1, {.first = segment_count, .count = 1});
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_run_overflowing_segment_count)
+{
+    segment_run(1, {.first = 5, .count = 0xffffffffu});
+    expect_rejected_untouched();
+}
+
+TEST_F(delta_payload_test_t, apply_rejects_invalid_x_max)
+{
+    auto modified = header();
+    modified.x_max = 0;
+    header(modified);
+    EXPECT_FALSE(sut_t::apply(delta, actual));
+}
+
+} // namespace
+} // namespace crv::spline
@@ -0,0 +1,201 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief constant-time spline segment locator exploiting dyadic segment widths
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/algorithm.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/int_traits.hpp>
+#include <crv/math/limits.hpp>
+#include <array>
+#include <bit>
+#include <span>
+
+namespace crv::spline {
+
+/// segment locator indexing a bucket table by the leading bits of x
+///
+/// Segments produced by the amr generator have power-of-2 widths and start on multiples of their widths. Their widths
+/// also tend to scale with x: narrow near 0 where curves bend the most, wide far out. That is the same distribution
+/// floating point uses, so buckets are laid out the same way. The domain is split into octaves by the position of x's
+/// leading 1, and each octave is split into 2^mantissa_bits equal buckets by the next bits below it. Values below the
+/// first octave form a single linear range, like subnormals.
+///
+/// Each bucket stores the first segment it overlaps. A lookup computes the bucket arithmetically, loads its entry, then
+/// runs probe_count branchless steps forward through the segment origins to handle buckets spanning segment
+/// boundaries. Latency is constant: one table load, probe_count key loads, and one origin load, with no data-dependent
+/// branches.
+///
+/// A bucket can only resolve as many boundaries as it has probes. A spline whose segments are too fine for its buckets
+/// is rejected by is_valid(). Callers building payloads check is_valid() and fall back to segment_locator_t when it
+/// fails.
+///
+/// This type has the same interface and constructor as segment_locator_t, so it plugs into spline_t and assembler_t
+/// unchanged.
+template <is_fixed t_x_t, int t_max_segment_count, int t_log2_min_width, int t_log2_domain_end, int t_mantissa_bits,
+    int t_probe_count = 1>
+class dyadic_segment_locator_t
+{
+public:
+    using x_t = t_x_t;
+    using value_t = x_t::value_t;
+
+    static constexpr auto max_segment_count = int_t{t_max_segment_count};
+    static constexpr auto total_key_count = max_segment_count - 1;
+
+    static constexpr auto log2_min_width = int_t{t_log2_min_width};
+    static constexpr auto log2_domain_end = int_t{t_log2_domain_end};
+    static constexpr auto mantissa_bits = int_t{t_mantissa_bits};
+    static constexpr auto probe_count = int_t{t_probe_count};
+
+    /// bit position of the start of the first octave; values below it are in the linear range
+    static constexpr auto first_octave_bit = x_t::frac_bits + log2_min_width;
+
+    /// bit position of the end of the domain
+    static constexpr auto domain_end_bit = x_t::frac_bits + log2_domain_end;
+
+    static constexpr auto buckets_per_octave = int_t{1} << mantissa_bits;
+    static constexpr auto octave_count = domain_end_bit - first_octave_bit + 1; // includes linear range
+    static constexpr auto bucket_count = octave_count * buckets_per_octave;
+
+    using bucket_t = uint16_t;
+    using buckets_t = std::array<bucket_t, bucket_count>;
+    using keys_t = std::array<x_t, max_segment_count + 1>; // origins followed by x_max sentinel
+
+    static_assert(0 < max_segment_count && max_segment_count <= max<bucket_t>() + 1);
+    static_assert(0 <= mantissa_bits && mantissa_bits <= first_octave_bit);
+    static_assert(first_octave_bit < domain_end_bit && domain_end_bit < static_cast<int_t>(sizeof(value_t) * 8 - 1));
+    static_assert(0 <= probe_count);
+
+    struct result_t
+    {
+        int_t index;
+        x_t origin;
+
+        auto operator<=>(result_t const&) const noexcept -> auto = default;
+        auto operator==(result_t const&) const noexcept -> bool = default;
+    };
+
+    constexpr dyadic_segment_locator_t() noexcept : x_max_{}, segment_count_{}, buckets_{}, keys_{} {}
+
+    explicit constexpr dyadic_segment_locator_t(
+        std::span<x_t const, total_key_count> sorted_keys, x_t x_max, int_t segment_count) noexcept
+        : x_max_{x_max}, segment_count_{segment_count}, buckets_{}, keys_{}
+    {
+        // this type goes over the ioctl boundary, so it must be trivially copyable
+        static_assert(std::is_trivially_copyable_v<dyadic_segment_locator_t>);
+
+        keys_[0] = x_t{0};
+        for (auto key_index = 0; key_index < total_key_count; ++key_index)
+        {
+            keys_[key_index + 1] = sorted_keys[key_index];
+        }
+        keys_[max_segment_count] = x_max;
+
+        // bucket starts increase monotonically, so the containing segment can be tracked with a single cursor
+        auto segment_index = int_t{0};
+        for (auto bucket = int_t{0}; bucket < bucket_count; ++bucket)
+        {
+            auto const start = bucket_start(bucket);
+            while (segment_index + 1 < segment_count_ && keys_[segment_index + 1] <= start) ++segment_index;
+            buckets_[bucket] = static_cast<bucket_t>(segment_index);
+        }
+    }
+
+    constexpr auto locate(x_t x) const noexcept -> result_t
+    {
+        // clamp below x_max so probing never passes the final segment
+        auto const value = min(x.value, static_cast<value_t>(x_max_.value - 1));
+
+        auto index = static_cast<int_t>(buckets_[bucket_of(value)]);
+        for (auto probe = 0; probe < probe_count; ++probe) index += (value >= keys_[index + 1].value);
+
+        return {.index = index, .origin = keys_[index]};
+    }
+
+    /// start of a segment
+    ///
+    /// \pre 0 <= segment_index < segment_count()
+    constexpr auto origin(int_t segment_index) const noexcept -> x_t { return keys_[segment_index]; }
+
+    /// number of real segments; the rest of the key array is padding
+    constexpr auto segment_count() const noexcept -> int_t { return segment_count_; }
+
+    /// end of final segment
+    constexpr auto x_max() const noexcept -> x_t { return x_max_; }
+
+    /// validates keys, and that every bucket reaches all of its segments within probe_count steps
+    constexpr auto is_valid() const noexcept -> bool
+    {
+        // validate segment_count is in valid range
+        if (segment_count_ <= 0 || max_segment_count < segment_count_) return false;
+
+        // validate x_max is positive and inside the bucketed domain
+        if (x_max_ <= x_t{0} || x_t::literal(value_t{1} << domain_end_bit) < x_max_) return false;
+
+        // validate real breakpoints in sorted order
+        if (keys_[0] != x_t{0}) return false;
+        for (auto key_index = 1; key_index < segment_count_; ++key_index)
+        {
+            if (keys_[key_index] <= keys_[key_index - 1]) return false;
+            if (keys_[key_index] >= x_max_) return false;
+        }
+
+        // padding keys: must be >= x_max_ so probing stops at the final segment
+        for (auto key_index = segment_count_; key_index <= max_segment_count; ++key_index)
+        {
+            if (keys_[key_index] < x_max_) return false;
+        }
+
+        // every bucket entry must be a real segment starting at or before the bucket, and the bucket's last value must
+        // be reachable by probing
+        auto last_segment = int_t{0};
+        for (auto bucket = int_t{0}; bucket < bucket_count; ++bucket)
+        {
+            auto const entry = static_cast<int_t>(buckets_[bucket]);
+            if (segment_count_ <= entry) return false;
+
+            auto const start = bucket_start(bucket);
+            if (start >= x_max_) continue;
+            if (start < keys_[entry]) return false;
+
+            auto const last = x_t::literal(min(bucket_start(bucket + 1).value, x_max_.value) - 1);
+            while (last_segment + 1 < segment_count_ && keys_[last_segment + 1] <= last) ++last_segment;
+            if (probe_count < last_segment - entry) return false;
+        }
+
+        return true;
+    }
+
+    constexpr auto prefetch(auto const& prefetcher) const noexcept -> void { prefetcher.prefetch(buckets_); }
+
+private:
+    /// maps a nonnegative value below 2^domain_end_bit to its bucket
+    static constexpr auto bucket_of(value_t value) noexcept -> int_t
+    {
+        // octave above the linear range; 0 for both the linear range and the first octave, which share a bucket width
+        auto const leading_bit = static_cast<int_t>(std::bit_width(static_cast<make_unsigned_t<value_t>>(value)));
+        auto const octave = max(leading_bit - first_octave_bit - 1, int_t{0});
+
+        return static_cast<int_t>(value >> (first_octave_bit - mantissa_bits + octave)) + (octave << mantissa_bits);
+    }
+
+    /// smallest value in a bucket; inverse of bucket_of()
+    static constexpr auto bucket_start(int_t bucket) noexcept -> x_t
+    {
+        auto const octave = max((bucket >> mantissa_bits) - 1, int_t{0});
+        auto const mantissa = static_cast<value_t>(bucket - (octave << mantissa_bits));
+        return x_t::literal(mantissa << (first_octave_bit - mantissa_bits + octave));
+    }
+
+    x_t x_max_;
+    int_t segment_count_;
+    alignas(64) buckets_t buckets_;
+    alignas(64) keys_t keys_;
+};
+
+} // namespace crv::spline
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "dyadic_segment_locator.hpp"
+#include <crv/test/test.hpp>
+#include <algorithm>
+
+namespace crv::spline {
+namespace {
+
+// small enough to sweep exhaustively
+//
+// With 4 fractional bits, log2_min_width -2 puts the first octave at raw value 4, and log2_domain_end 3 ends the domain
+// at raw value 128. With 1 mantissa bit, buckets are 2 wide below 8, then 4, 8, 16, and 32 wide per octave.
+using x_t = fixed_t<int64_t, 4>;
+constexpr auto max_segment_count = 8;
+constexpr auto log2_min_width = -2;
+constexpr auto log2_domain_end = 3;
+constexpr auto mantissa_bits = 1;
+
+template <int probe_count>
+using sut_t
+    = dyadic_segment_locator_t<x_t, max_segment_count, log2_min_width, log2_domain_end, mantissa_bits, probe_count>;
+
+using keys_t = std::array<x_t, max_segment_count - 1>;
+
+constexpr auto x_max = x_t::literal(128);
+
+// pads raw breakpoints to a full key array
+constexpr auto make_keys(std::initializer_list<int64_t> breakpoints) noexcept -> keys_t
+{
+    auto result = keys_t{};
+    std::ranges::fill(result, x_max);
+    std::ranges::transform(breakpoints, result.begin(), [](int64_t value) { return x_t::literal(value); });
+    return result;
+}
+
+// ====================================================================================================================
+// layout
+// ====================================================================================================================
+
+static_assert(sut_t<0>::first_octave_bit == 2);
+static_assert(sut_t<0>::domain_end_bit == 7);
+static_assert(sut_t<0>::octave_count == 6);
+static_assert(sut_t<0>::bucket_count == 12);
+
+// ====================================================================================================================
+// is_valid
+// ====================================================================================================================
+
+namespace is_valid_tests {
+
+// dyadic segments, each at least as wide as the buckets it covers
+constexpr auto dyadic_keys = make_keys({2, 4, 8, 16, 32, 64});
+constexpr auto dyadic_count = 7;
+
+// valid baseline
+static_assert(sut_t<0>{dyadic_keys, x_max, dyadic_count}.is_valid());
+
+// single segment
+static_assert(sut_t<0>{make_keys({}), x_max, 1}.is_valid());
+
+// segment count out of range
+static_assert(!sut_t<0>{dyadic_keys, x_max, 0}.is_valid());
+static_assert(!sut_t<0>{dyadic_keys, x_max, max_segment_count + 1}.is_valid());
+
+// x_max out of range
+static_assert(!sut_t<0>{make_keys({}), x_t::literal(0), 1}.is_valid());
+static_assert(!sut_t<0>{make_keys({}), x_t::literal(129), 1}.is_valid());
+
+// keys out of order
+static_assert(!sut_t<1>{make_keys({2, 8, 4}), x_max, 4}.is_valid());
+
+// duplicate keys
+static_assert(!sut_t<1>{make_keys({2, 2}), x_max, 3}.is_valid());
+
+// real key at or beyond x_max
+static_assert(!sut_t<1>{make_keys({64}), x_t::literal(64), 2}.is_valid());
+
+// padding below x_max
+static_assert(!sut_t<1>{make_keys({2, 4, 8}), x_max, 2}.is_valid());
+
+// a bucket spanning one boundary needs one probe
+static_assert(!sut_t<0>{make_keys({3}), x_max, 2}.is_valid());
+static_assert(sut_t<1>{make_keys({3}), x_max, 2}.is_valid());
+
+// a bucket spanning two boundaries needs two probes
+static_assert(!sut_t<1>{make_keys({65, 66}), x_max, 3}.is_valid());
+static_assert(sut_t<2>{make_keys({65, 66}), x_max, 3}.is_valid());
+
+} // namespace is_valid_tests
+
+// ====================================================================================================================
+// locate
+// ====================================================================================================================
+
+namespace sweep_tests {
+
+// reference implementation: count of keys <= x is the segment index; last such key is origin
+template <int probe_count> constexpr auto expected_result(keys_t const& keys, int_t segment_count, x_t x)
+{
+    auto const real_keys = std::span{keys}.first(static_cast<std::size_t>(segment_count - 1));
+    auto const bound = std::upper_bound(real_keys.begin(), real_keys.end(), x);
+    auto const index = static_cast<int_t>(bound - real_keys.begin());
+    auto const origin = (bound == real_keys.begin()) ? x_t{0} : *(bound - 1);
+    return typename sut_t<probe_count>::result_t{.index = index, .origin = origin};
+}
+
+template <int probe_count> constexpr auto test_sweep(keys_t const& keys, int_t segment_count) -> bool
+{
+    auto const sut = sut_t<probe_count>{keys, x_max, segment_count};
+    if (!sut.is_valid()) return false;
+
+    for (auto value = int64_t{0}; value < x_max.value; ++value)
+    {
+        auto const x = x_t::literal(value);
+        auto const result = sut.locate(x);
+        if (result != expected_result<probe_count>(keys, segment_count, x)) return false;
+        if (result.origin != sut.origin(result.index)) return false;
+    }
+
+    return true;
+}
+
+// one segment
+static_assert(test_sweep<0>(make_keys({}), 1));
+
+// dyadic segments
+static_assert(test_sweep<0>(make_keys({2, 4, 8, 16, 32, 64}), 7));
+
+// uniform segments; the widest buckets span one boundary
+static_assert(test_sweep<1>(make_keys({16, 32, 48, 64, 80, 96, 112}), 8));
+
+// segments finer than their buckets, resolved by probing
+static_assert(test_sweep<1>(make_keys({1, 2, 3, 4, 24, 100}), 7));
+static_assert(test_sweep<2>(make_keys({16, 65, 66}), 4));
+
+// clamps inputs at or beyond x_max to the final segment
+static_assert(sut_t<1>{make_keys({3}), x_max, 2}.locate(x_max) == sut_t<1>::result_t{1, x_t::literal(3)});
+static_assert(sut_t<1>{make_keys({3}), x_max, 2}.locate(x_t::literal(1000)) == sut_t<1>::result_t{1, x_t::literal(3)});
+
+} // namespace sweep_tests
+
+// ====================================================================================================================
+// prefetch
+// ====================================================================================================================
+
+namespace prefetch_tests {
+
+struct tracking_prefetcher_t
+{
+    mutable std::size_t actual_size = 0;
+
+    template <typename range_t> constexpr auto prefetch(range_t const& range) const noexcept -> void
+    {
+        actual_size = std::size(range);
+    }
+};
+
+constexpr auto test_prefetcher() noexcept -> bool
+{
+    auto const prefetcher = tracking_prefetcher_t{};
+    sut_t<0>{make_keys({}), x_max, 1}.prefetch(prefetcher);
+    return prefetcher.actual_size == sut_t<0>::bucket_count;
+}
+static_assert(test_prefetcher());
+
+} // namespace prefetch_tests
+
+} // namespace
+} // namespace crv::spline
@@ -0,0 +1,148 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief policies for locating a spline segment using the previous locate as a hint
+///
+/// Mouse velocity changes slowly between reports, so most locates land in the same segment as the last one, or a
+/// neighbor. A hint policy sits between spline_t and its segment locator and may answer from what it remembers before
+/// falling back to a full locate. Hints are per reader; each lives in a spline_t::cursor_t.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <array>
+
+namespace crv::spline::locate_hints {
+
+// ====================================================================================================================
+// Counters
+// ====================================================================================================================
+
+/// discards hit and miss counts; compiles away
+struct null_counters_t
+{
+    constexpr auto hit() noexcept -> void {}
+    constexpr auto miss() noexcept -> void {}
+
+    constexpr auto operator==(null_counters_t const&) const noexcept -> bool = default;
+};
+
+/// counts locates answered from the hint and locates that fell back to the segment locator
+struct counters_t
+{
+    int64_t hits = 0;
+    int64_t misses = 0;
+
+    constexpr auto hit() noexcept -> void { ++hits; }
+    constexpr auto miss() noexcept -> void { ++misses; }
+
+    constexpr auto operator==(counters_t const&) const noexcept -> bool = default;
+};
+
+// ====================================================================================================================
+// Policies
+// ====================================================================================================================
+
+/// ignores history and always locates through the segment locator
+struct none_t
+{
+    template <typename segment_locator_t, typename x_t>
+    constexpr auto locate(segment_locator_t const& segment_locator, x_t x) const noexcept -> auto
+    {
+        return segment_locator.locate(x);
+    }
+
+    constexpr auto is_valid(auto const&) const noexcept -> bool { return true; }
+};
+
+/// remembers the bounds of the previous segment and both neighbors
+///
+/// The window holds 4 consecutive segment bounds: the start of the previous segment's left neighbor through the end of
+/// its right neighbor. An input inside the window is resolved with 2 compares and no loads outside this object. An
+/// input outside it misses, falls back to the segment locator, and recenters the window on the result. Landing in a
+/// neighbor also recenters, so the window follows slow drift.
+///
+/// The window starts empty, so the first locate always misses. Bounds are copied from the segment locator, so a window
+/// built against one locator is not valid for another; spline_t's cursors start over on a new locator rather than keep
+/// one, and is_valid() checks a window against a locator.
+template <typename t_x_t, typename t_counters_t = null_counters_t> class window_t
+{
+public:
+    using x_t = t_x_t;
+    using counters_t = t_counters_t;
+
+    /// \pre 0 <= x < segment_locator.x_max()
+    template <typename segment_locator_t>
+    constexpr auto locate(segment_locator_t const& segment_locator, x_t x) noexcept -> segment_locator_t::result_t
+    {
+        if (bounds_[0] <= x && x < bounds_[bound_count - 1]) [[likely]]
+        {
+            counters_.hit();
+
+            // 0 for left neighbor, 1 for previous segment, 2 for right neighbor
+            auto const offset = static_cast<int_t>(x >= bounds_[1]) + static_cast<int_t>(x >= bounds_[2]);
+            auto const result
+                = typename segment_locator_t::result_t{.index = index_ - 1 + offset, .origin = bounds_[offset]};
+
+            if (offset != 1) recenter(segment_locator, result.index);
+            return result;
+        }
+
+        counters_.miss();
+
+        auto const result = segment_locator.locate(x);
+        recenter(segment_locator, result.index);
+        return result;
+    }
+
+    /// validates window is empty or matches segment_locator exactly
+    ///
+    /// \pre segment_locator.is_valid()
+    template <typename segment_locator_t>
+    constexpr auto is_valid(segment_locator_t const& segment_locator) const noexcept -> bool
+    {
+        // an empty window never hits, so its index is never used
+        if (bounds_[bound_count - 1] <= bounds_[0]) return true;
+
+        if (index_ < 0 || segment_locator.segment_count() <= index_) return false;
+        for (auto bound = 0; bound < bound_count; ++bound)
+        {
+            if (bounds_[bound] != bound_at(segment_locator, index_ - 1 + bound)) return false;
+        }
+
+        return true;
+    }
+
+    constexpr auto counters() const noexcept -> counters_t const& { return counters_; }
+
+private:
+    static constexpr auto bound_count = 4;
+    using bounds_t = std::array<x_t, bound_count>;
+
+    /// start of a segment, clamped to [0, x_max]
+    template <typename segment_locator_t>
+    static constexpr auto bound_at(segment_locator_t const& segment_locator, int_t segment_index) noexcept -> x_t
+    {
+        if (segment_index <= 0) return x_t{0};
+        if (segment_locator.segment_count() <= segment_index) return segment_locator.x_max();
+        return segment_locator.origin(segment_index);
+    }
+
+    template <typename segment_locator_t>
+    constexpr auto recenter(segment_locator_t const& segment_locator, int_t segment_index) noexcept -> void
+    {
+        index_ = segment_index;
+        for (auto bound = 0; bound < bound_count; ++bound)
+        {
+            bounds_[bound] = bound_at(segment_locator, segment_index - 1 + bound);
+        }
+    }
+
+    bounds_t bounds_{};
+    int_t index_{};
+    [[no_unique_address]] counters_t counters_{};
+};
+
+} // namespace crv::spline::locate_hints
@@ -0,0 +1,139 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "locate_hint.hpp"
+#include <crv/spline/segment_locator.hpp>
+#include <crv/test/test.hpp>
+#include <array>
+
+namespace crv::spline::locate_hints {
+namespace {
+
+using x_t = int_t;
+
+// 10 segments of width 10, padded to 16
+using segment_locator_t = segment_locator_t<x_t, 2>;
+constexpr auto segment_count = 10;
+constexpr auto x_max = x_t{100};
+
+constexpr auto create_locator(x_t stride) noexcept -> segment_locator_t
+{
+    auto keys = std::array<x_t, segment_locator_t::total_key_count>{};
+    for (auto index = 0; index < segment_locator_t::total_key_count; ++index)
+    {
+        keys[index] = index + 1 < segment_count ? (index + 1) * stride : segment_count * stride;
+    }
+    return segment_locator_t{keys, segment_count * stride, segment_count};
+}
+
+constexpr auto segment_locator = create_locator(10);
+
+// ====================================================================================================================
+// none_t
+// ====================================================================================================================
+
+namespace none_tests {
+
+static_assert(none_t{}.locate(segment_locator, 0) == segment_locator_t::result_t{0, 0});
+static_assert(none_t{}.locate(segment_locator, 55) == segment_locator_t::result_t{5, 50});
+static_assert(none_t{}.is_valid(segment_locator));
+
+} // namespace none_tests
+
+// ====================================================================================================================
+// window_t
+// ====================================================================================================================
+
+namespace window_tests {
+
+using sut_t = window_t<x_t, counters_t>;
+
+// window must agree with the locator for every input, whatever order they arrive in
+constexpr auto test_sweep(x_t stride) noexcept -> bool
+{
+    auto sut = sut_t{};
+    for (auto step = 0; step < x_max; ++step)
+    {
+        auto const x = (step * stride) % x_max;
+        if (sut.locate(segment_locator, x) != segment_locator.locate(x)) return false;
+        if (!sut.is_valid(segment_locator)) return false;
+    }
+    return true;
+}
+
+static_assert(test_sweep(1)); // ascending, mostly hits
+static_assert(test_sweep(99)); // descending, mostly hits
+static_assert(test_sweep(7)); // crosses into neighbors
+static_assert(test_sweep(37)); // jumps far, mostly misses
+
+// each locate either hits or misses
+static_assert([] {
+    auto sut = sut_t{};
+    for (auto x = x_t{0}; x < x_max; ++x) sut.locate(segment_locator, x);
+    return sut.counters().hits + sut.counters().misses == x_max;
+}());
+
+constexpr auto test_counters() noexcept -> bool
+{
+    auto sut = sut_t{};
+    auto expected = counters_t{};
+
+    // empty window misses
+    sut.locate(segment_locator, 55);
+    ++expected.misses;
+    if (sut.counters() != expected) return false;
+
+    // same segment hits
+    sut.locate(segment_locator, 59);
+    ++expected.hits;
+    if (sut.counters() != expected) return false;
+
+    // both neighbors hit
+    sut.locate(segment_locator, 60);
+    sut.locate(segment_locator, 55);
+    expected.hits += 2;
+    if (sut.counters() != expected) return false;
+
+    // two segments away misses
+    sut.locate(segment_locator, 75);
+    ++expected.misses;
+    if (sut.counters() != expected) return false;
+
+    // window recentered on the miss, so its neighbor now hits
+    sut.locate(segment_locator, 89);
+    ++expected.hits;
+    return sut.counters() == expected;
+}
+static_assert(test_counters());
+
+// first and last segments clamp the window to the domain
+static_assert([] {
+    auto sut = sut_t{};
+    sut.locate(segment_locator, 0);
+    return sut.locate(segment_locator, 15) == segment_locator_t::result_t{1, 10} && sut.counters().hits == 1;
+}());
+static_assert([] {
+    auto sut = sut_t{};
+    sut.locate(segment_locator, 99);
+    return sut.locate(segment_locator, 85) == segment_locator_t::result_t{8, 80} && sut.counters().hits == 1;
+}());
+
+// empty window is valid for any locator
+static_assert(sut_t{}.is_valid(segment_locator));
+
+// populated window is only valid for the locator it was populated from
+static_assert([] {
+    auto sut = sut_t{};
+    sut.locate(segment_locator, 55);
+    return sut.is_valid(segment_locator) && !sut.is_valid(create_locator(9));
+}());
+
+// counters compile away
+static_assert(sizeof(window_t<x_t>) < sizeof(window_t<x_t, counters_t>));
+
+} // namespace window_tests
+
+} // namespace
+} // namespace crv::spline::locate_hints
@@ -0,0 +1,173 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief searches within a single segment locator node
+///
+/// A node search counts the keys in a node that are <= x and selects the largest of them as the new origin. The scalar
+/// search is portable and branchless. The simd searches compare all keys of a node at once using 64-bit integer
+/// compares.
+///
+/// Selection is compile-time only. The simd searches are compiled in when the target enables the instruction set and
+/// this is not a kernel build. The kernel never enables sse or avx for module code, and using them would require
+/// bracketing every event with kernel_fpu_begin()/kernel_fpu_end(), which costs more than the whole descent, so kernel
+/// builds always use the scalar search.
+///
+/// The simd searches shorten each level's instruction count but lengthen its dependency chain: compare, movemask, and
+/// popcount sit between one node's load and the next. performance_test_segment_locator shows avx2 ahead when many
+/// independent locates overlap, as in spline_t::evaluate(), and scalar ahead when each locate waits on the last, as on
+/// the per-event path. The default is therefore scalar, and simd_t names the widest available simd search for callers
+/// that batch.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/fixed.hpp>
+#include <bit>
+#include <concepts>
+#include <type_traits>
+#include <utility>
+
+#if !defined __KERNEL__ && (defined __AVX2__ || defined __SSE4_2__)
+#include <immintrin.h>
+#endif
+
+namespace crv::spline::node_searches {
+
+/// type of the keys in a node
+template <typename node_t> using key_t = std::remove_cvref_t<decltype(std::declval<node_t const&>().keys[0])>;
+
+template <typename x_t> struct result_t
+{
+    int_t child_offset; ///< number of keys <= x
+    x_t origin; ///< largest key <= x, or previous origin if there is none
+
+    auto operator==(result_t const&) const noexcept -> bool = default;
+};
+
+/// portable, branchless search
+struct scalar_t
+{
+    template <typename node_t, typename x_t = key_t<node_t>>
+    constexpr auto operator()(node_t const& node, std::type_identity_t<x_t> x, std::type_identity_t<x_t> origin) const
+        noexcept -> result_t<x_t>
+    {
+        // alias keys locally in sorted order
+        auto const key0 = node.keys[0];
+        auto const key1 = node.keys[1];
+        auto const key2 = node.keys[2];
+
+        // choose lower bound key
+        origin = (x >= key0) ? key0 : origin;
+        origin = (x >= key1) ? key1 : origin;
+        origin = (x >= key2) ? key2 : origin;
+
+        // choose lower bound offset
+        auto const child_offset = (x >= key0) + (x >= key1) + (x >= key2);
+
+        return {.child_offset = child_offset, .origin = origin};
+    }
+};
+
+namespace detail {
+
+/// keys the simd searches can compare directly: signed 64-bit integers, or fixed-point wrappers around them
+template <typename x_t>
+concept is_simd_key = (std::same_as<x_t, int64_t> || std::same_as<x_t, int_t>)
+    || (is_fixed<x_t> && std::same_as<typename x_t::value_t, int64_t> && sizeof(x_t) == sizeof(int64_t));
+
+template <is_simd_key x_t> constexpr auto raw_value(x_t x) noexcept -> int64_t
+{
+    if constexpr (is_fixed<x_t>) return x.value;
+    else return x;
+}
+
+/// completes a simd search from a mask of keys that are > x
+///
+/// Keys are sorted, so the keys <= x form a prefix, and the child offset is the length of that prefix.
+template <typename node_t, typename x_t>
+constexpr auto finish(node_t const& node, int greater_mask, x_t origin) noexcept -> result_t<x_t>
+{
+    constexpr auto key_mask = 0b111; // ignore the padding lane
+    auto const child_offset = int_t{3} - std::popcount(static_cast<unsigned>(greater_mask & key_mask));
+
+    // select without branching; key_index is clamped so the load is always in bounds
+    auto const key_index = (child_offset == 0) ? 0 : child_offset - 1;
+    auto const key = node.keys[key_index];
+    return {.child_offset = child_offset, .origin = (child_offset == 0) ? origin : key};
+}
+
+} // namespace detail
+
+#if !defined __KERNEL__ && defined __SSE4_2__
+
+/// compares a node as two pairs of keys using sse4.2
+struct sse42_t
+{
+    template <typename node_t, typename x_t = key_t<node_t>>
+    constexpr auto operator()(node_t const& node, std::type_identity_t<x_t> x, std::type_identity_t<x_t> origin) const
+        noexcept -> result_t<x_t>
+    {
+        if constexpr (!detail::is_simd_key<x_t>) return scalar_t{}(node, x, origin);
+        else
+        {
+            if consteval { return scalar_t{}(node, x, origin); }
+
+            static_assert(sizeof(node_t) == 32 && alignof(node_t) >= 16);
+
+            auto const* const lanes = reinterpret_cast<__m128i const*>(&node);
+            auto const x_lanes = _mm_set1_epi64x(detail::raw_value(x));
+            auto const greater_lo = _mm_cmpgt_epi64(_mm_load_si128(lanes + 0), x_lanes);
+            auto const greater_hi = _mm_cmpgt_epi64(_mm_load_si128(lanes + 1), x_lanes);
+            auto const greater_mask = _mm_movemask_pd(_mm_castsi128_pd(greater_lo))
+                | (_mm_movemask_pd(_mm_castsi128_pd(greater_hi)) << 2);
+
+            return detail::finish(node, greater_mask, origin);
+        }
+    }
+};
+
+#endif
+
+#if !defined __KERNEL__ && defined __AVX2__
+
+/// compares a whole node at once using avx2
+struct avx2_t
+{
+    template <typename node_t, typename x_t = key_t<node_t>>
+    constexpr auto operator()(node_t const& node, std::type_identity_t<x_t> x, std::type_identity_t<x_t> origin) const
+        noexcept -> result_t<x_t>
+    {
+        if constexpr (!detail::is_simd_key<x_t>) return scalar_t{}(node, x, origin);
+        else
+        {
+            if consteval { return scalar_t{}(node, x, origin); }
+
+            static_assert(sizeof(node_t) == 32 && alignof(node_t) >= 32);
+
+            auto const keys = _mm256_load_si256(reinterpret_cast<__m256i const*>(&node));
+            auto const greater = _mm256_cmpgt_epi64(keys, _mm256_set1_epi64x(detail::raw_value(x)));
+            auto const greater_mask = _mm256_movemask_pd(_mm256_castsi256_pd(greater));
+
+            return detail::finish(node, greater_mask, origin);
+        }
+    }
+};
+
+using simd_t = avx2_t;
+
+#elif !defined __KERNEL__ && defined __SSE4_2__
+
+using simd_t = sse42_t;
+
+#else
+
+using simd_t = scalar_t;
+
+#endif
+
+/// search used when none is specified; lowest latency for a single locate
+using default_t = scalar_t;
+
+} // namespace crv::spline::node_searches
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "node_search.hpp"
+#include <crv/math/fixed/fixed.hpp>
+#include <crv/math/limits.hpp>
+#include <crv/test/test.hpp>
+#include <array>
+#include <concepts>
+
+namespace crv::spline::node_searches {
+namespace {
+
+using x_t = int_t;
+using result_t = result_t<x_t>;
+
+template <typename x_t> struct alignas(32) node_t
+{
+    std::array<x_t, 3> keys;
+};
+
+constexpr auto node = node_t<x_t>{{10, 20, 30}};
+constexpr auto origin = x_t{-1};
+
+// ====================================================================================================================
+// scalar_t
+// ====================================================================================================================
+
+namespace scalar_tests {
+
+constexpr auto sut = scalar_t{};
+
+// below all keys keeps origin
+static_assert(sut(node, 9, origin) == result_t{0, origin});
+
+// exact keys
+static_assert(sut(node, 10, origin) == result_t{1, 10});
+static_assert(sut(node, 20, origin) == result_t{2, 20});
+static_assert(sut(node, 30, origin) == result_t{3, 30});
+
+// between keys
+static_assert(sut(node, 19, origin) == result_t{1, 10});
+static_assert(sut(node, 29, origin) == result_t{2, 20});
+
+// above all keys
+static_assert(sut(node, max<x_t>(), origin) == result_t{3, 30});
+
+} // namespace scalar_tests
+
+// ====================================================================================================================
+// simd
+// ====================================================================================================================
+
+// simd searches fall back to scalar during constant evaluation
+static_assert(simd_t{}(node, 19, origin) == result_t{1, 10});
+
+// simd_unit_tests exists to run these searches; fail its build rather than silently testing only scalar
+#if defined CRV_SIMD_UNIT_TESTS
+static_assert(std::same_as<simd_t, avx2_t>, "simd_unit_tests must be built with sse4.2 and avx2 enabled");
+#endif
+
+template <typename sut_t> struct node_search_test_t : Test
+{
+    // compares against scalar for every x around a node's keys
+    template <typename x_t> static auto test_sweep(node_t<x_t> const& node) -> void
+    {
+        auto const sut = sut_t{};
+        auto const reference = scalar_t{};
+
+        auto const first = node.keys[0] - x_t{2};
+        auto const last = node.keys[2] + x_t{2};
+        for (auto x = first; x <= last; x += x_t{1})
+        {
+            ASSERT_EQ(reference(node, x, x_t{-1}), sut(node, x, x_t{-1}));
+        }
+    }
+};
+
+using node_search_types_t = Types<scalar_t
+#if !defined __KERNEL__ && defined __SSE4_2__
+    ,
+    sse42_t
+#endif
+#if !defined __KERNEL__ && defined __AVX2__
+    ,
+    avx2_t
+#endif
+    >;
+TYPED_TEST_SUITE(node_search_test_t, node_search_types_t);
+
+TYPED_TEST(node_search_test_t, matches_scalar_int)
+{
+    TestFixture::test_sweep(node_t<int_t>{{-5, 0, 5}});
+}
+
+TYPED_TEST(node_search_test_t, matches_scalar_fixed)
+{
+    using x_t = fixed_t<int64_t, 42>;
+    TestFixture::test_sweep(node_t<x_t>{{x_t::literal(-3), x_t::literal(4), x_t::literal(5)}});
+}
+
+TYPED_TEST(node_search_test_t, ignores_padding_lane)
+{
+    using sut_t = TypeParam;
+
+    // fill the 4th lane with a key that would compare <= x if it were considered
+    struct alignas(32) padded_node_t
+    {
+        std::array<x_t, 3> keys;
+        x_t padding;
+    };
+    auto const padded_node = padded_node_t{{10, 20, 30}, min<x_t>()};
+
+    EXPECT_EQ((result_t{0, origin}), sut_t{}(padded_node, 9, origin));
+    EXPECT_EQ((result_t{2, 20}), sut_t{}(padded_node, 25, origin));
+}
+
+} // namespace
+} // namespace crv::spline::node_searches
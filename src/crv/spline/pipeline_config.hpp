@@ -9,15 +9,21 @@
 #include <crv/lib.hpp>
 #include <crv/math/fixed/fixed.hpp>
 #include <crv/spline/segment.hpp>
+#include <crv/spline/segment_storage.hpp>
 
 namespace crv::spline {
 
-template <typename t_x_t, typename t_y_t, segment_layout_t t_segment_layout> struct pipeline_config_t
+template <typename t_x_t, typename t_y_t, segment_layout_t t_segment_layout,
+    typename t_segment_storage_t = segment_storages::packed_t>
+struct pipeline_config_t
 {
     using x_t = t_x_t;
     using y_t = t_y_t;
 
     static constexpr auto segment_layout = t_segment_layout;
+
+    /// how splines keep their segments; see segment_storage.hpp
+    using segment_storage_t = t_segment_storage_t;
 };
 
 constexpr auto prod_pipeline_config = pipeline_config_t<fixed_t<int64_t, 42>, fixed_t<int64_t, 45>,
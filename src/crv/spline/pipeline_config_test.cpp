@@ -6,6 +6,7 @@
 #include "pipeline_config.hpp"
 #include <crv/lib.hpp>
 #include <crv/test/test.hpp>
+#include <concepts>
 
 namespace crv::spline {
 namespace {
@@ -30,5 +31,8 @@ static_assert(prod_pipeline_config.segment_layout.final.shift_width == 7);
 static_assert(!prod_pipeline_config.segment_layout.intermediate.is_signed);
 static_assert(prod_pipeline_config.segment_layout.final.is_signed);
 
+// segments stay packed; soa storage spreads each segment over 8 arrays, which only pays off when the spline stays hot
+static_assert(std::same_as<prod_pipeline_config_t::segment_storage_t, segment_storages::packed_t>);
+
 } // namespace
 } // namespace crv::spline
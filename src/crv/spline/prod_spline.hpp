@@ -0,0 +1,55 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief spline types used in production
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/spline/dyadic_segment_locator.hpp>
+#include <crv/spline/pipeline_config.hpp>
+#include <crv/spline/segment.hpp>
+#include <crv/spline/segment_locator.hpp>
+#include <crv/spline/spline.hpp>
+#include <crv/spline/tangent_extension.hpp>
+
+namespace crv::spline {
+
+/// depth of production segment locator tree; 4 levels address 256 segments
+constexpr auto prod_depth_max = 4;
+
+/// domain of production splines is [0, 2^prod_log2_domain_end)
+constexpr auto prod_log2_domain_end = 8;
+
+/// narrowest segment production splines subdivide to
+constexpr auto prod_log2_min_width = -10;
+
+/// dyadic locator buckets per octave are 2^prod_dyadic_mantissa_bits
+constexpr auto prod_dyadic_mantissa_bits = 4;
+
+/// boundaries a single dyadic locator bucket may span
+constexpr auto prod_dyadic_probe_count = 2;
+
+using prod_traits_t = traits_t<unpacked_field_t<int_t>>;
+using prod_field_unpacker_t = field_unpacker_t<prod_traits_t::unpacked_field_t>;
+using prod_segment_unpacker_t = segment_unpacker_t<prod_traits_t::packed_segment_t,
+    prod_traits_t::unpacked_segment_t, prod_field_unpacker_t, prod_pipeline_config.segment_layout>;
+using prod_segment_evaluator_t
+    = segment_evaluator_t<prod_traits_t, prod_pipeline_config_t::x_t, prod_pipeline_config_t::y_t>;
+using prod_segment_t
+    = segment_t<prod_traits_t, prod_pipeline_config_t::x_t, prod_segment_unpacker_t, prod_segment_evaluator_t>;
+using prod_segment_locator_t = segment_locator_t<prod_pipeline_config_t::x_t, prod_depth_max>;
+using prod_extended_tangent_t = extended_tangent_t<prod_pipeline_config_t::x_t, prod_pipeline_config_t::y_t,
+    prod_traits_t::unpacked_field_t>;
+using prod_spline_t = spline_t<prod_segment_t, prod_extended_tangent_t, prod_segment_locator_t, locate_hints::none_t,
+    prod_pipeline_config_t::segment_storage_t>;
+
+/// constant-latency alternative to prod_segment_locator_t; only valid for splines whose segments fit its buckets
+using prod_dyadic_segment_locator_t = dyadic_segment_locator_t<prod_pipeline_config_t::x_t,
+    prod_segment_locator_t::max_segment_count, prod_log2_min_width, prod_log2_domain_end, prod_dyadic_mantissa_bits,
+    prod_dyadic_probe_count>;
+using prod_dyadic_spline_t = spline_t<prod_segment_t, prod_extended_tangent_t, prod_dyadic_segment_locator_t,
+    locate_hints::none_t, prod_pipeline_config_t::segment_storage_t>;
+
+} // namespace crv::spline
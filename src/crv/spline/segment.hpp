@@ -152,6 +152,15 @@ struct segment_unpacker_t
 // evaluation
 // --------------------------------------------------------------------------------------------------------------------
 
+/// value of a segment and its slope, dy/dx, at the same input
+template <typename y_t> struct value_and_slope_t
+{
+    y_t value;
+    y_t slope;
+
+    constexpr auto operator==(value_and_slope_t const&) const noexcept -> bool = default;
+};
+
 template <typename traits_t, is_fixed t_x_t, is_fixed t_y_t,
     auto shifter = shifter_t<rounding_modes::shr::fast::nearest_up>{}>
 struct segment_evaluator_t
@@ -167,15 +176,63 @@ struct segment_evaluator_t
 
     static constexpr auto max_shift = static_cast<int_t>(sizeof(wide_t) * CHAR_BIT) - 1;
 
+    /// evaluates only the steps from the first nonzero coefficient
+    ///
+    /// A zero accumulator stays zero through a step: the product is 0, and 0 rounds to 0 under any shift. The step's
+    /// result is exactly the next coefficient, so leading zero coefficients are skipped without changing the result.
+    /// Flat regions quantize to linear or constant segments, which skip 2 or 3 wide multiplies. Cubics pay one
+    /// predictable branch.
     constexpr auto operator()(unpacked_segment_t const& unpacked_segment, x_t const& x) const noexcept -> y_t
     {
-        auto accumulator = unpacked_segment[0].mantissa;
-        accumulator = apply_coefficient(unpacked_segment[1].mantissa, unpacked_segment[0].shift, x, accumulator);
-        accumulator = apply_coefficient(unpacked_segment[2].mantissa, unpacked_segment[1].shift, x, accumulator);
-        accumulator = apply_coefficient(unpacked_segment[3].mantissa, unpacked_segment[2].shift, x, accumulator);
+        auto const degree = degree_of(unpacked_segment);
+        auto accumulator = unpacked_segment[fields_per_segment - 1 - degree].mantissa;
+        switch (degree)
+        {
+        case 3:
+            accumulator = apply_coefficient(unpacked_segment[1].mantissa, unpacked_segment[0].shift, x, accumulator);
+            [[fallthrough]];
+        case 2:
+            accumulator = apply_coefficient(unpacked_segment[2].mantissa, unpacked_segment[1].shift, x, accumulator);
+            [[fallthrough]];
+        case 1:
+            accumulator = apply_coefficient(unpacked_segment[3].mantissa, unpacked_segment[2].shift, x, accumulator);
+            [[fallthrough]];
+        default: break;
+        }
         return align_to_y(accumulator, unpacked_segment[3].shift);
     }
 
+    /// evaluates value and slope together, sharing the value's Horner steps
+    ///
+    /// Differentiating a step, acc' = (acc*x + c) >> shift, gives slope' = (slope*x + acc) >> shift. The slope is
+    /// carried wide, with x's fractional bits on top of the accumulator's, so it is per unit of x rather than per ulp
+    /// of x, and needs no extra shifts stored in the segment. It aligns to y with the same final shift as the value.
+    constexpr auto with_slope(unpacked_segment_t const& unpacked_segment, x_t const& x) const noexcept
+        -> value_and_slope_t<y_t>
+    {
+        auto const first_field = fields_per_segment - 1 - degree_of(unpacked_segment);
+        auto accumulator = unpacked_segment[first_field].mantissa;
+        auto slope = wide_t{0};
+        for (auto field = first_field; field < fields_per_segment - 1; ++field)
+        {
+            auto const relative_shift = unpacked_segment[field].shift;
+            slope = apply_slope(slope, accumulator, relative_shift, x);
+            accumulator = apply_coefficient(unpacked_segment[field + 1].mantissa, relative_shift, x, accumulator);
+        }
+
+        auto const final_shift = unpacked_segment[fields_per_segment - 1].shift;
+        return {.value = align_to_y(accumulator, final_shift), .slope = align_slope_to_y(slope, final_shift)};
+    }
+
+    /// degree implied by leading zero coefficients; constants are degree 0
+    static constexpr auto degree_of(unpacked_segment_t const& unpacked_segment) noexcept -> int_t
+    {
+        if (unpacked_segment[0].mantissa != 0) [[likely]] return 3;
+        if (unpacked_segment[1].mantissa != 0) return 2;
+        if (unpacked_segment[2].mantissa != 0) return 1;
+        return 0;
+    }
+
 private:
     // prevents UB from signed integer overflow
     //
@@ -201,6 +258,32 @@ private:
         return safe_add(aligned_product, coeff);
     }
 
+    // as safe_add(), for products of the wide slope, which can't widen further
+    static constexpr auto safe_multiply(wide_t lhs, wide_t rhs) noexcept -> wide_t
+    {
+        using unsigned_t = make_unsigned_t<wide_t>;
+        return static_cast<wide_t>(static_cast<unsigned_t>(lhs) * static_cast<unsigned_t>(rhs));
+    }
+
+    constexpr auto apply_slope(wide_t slope, mantissa_t accumulator, int_t relative_shift, x_t const& x) const noexcept
+        -> wide_t
+    {
+        // accumulator has no factor of x, so it enters with x's fractional bits to match slope*x
+        auto const aligned_accumulator = widen(accumulator) << x_t::frac_bits;
+        auto const sum = safe_add(safe_multiply(slope, x.value), aligned_accumulator);
+        return shifter.template shr<wide_t>(sum, relative_shift);
+    }
+
+    constexpr auto align_slope_to_y(wide_t slope, int_t shift) const noexcept -> y_t
+    {
+        using y_value_t = y_t::value_t;
+
+        if (shift >= 0) return y_t::literal(saturate_cast<y_value_t>(shifter.template shr<wide_t>(slope, shift)));
+
+        // anything wider than narrow_t saturates y after a left shift anyway; narrowing first keeps the shift in range
+        return y_t::literal(saturate_cast<y_value_t>(shifter.shift(widen(saturate_cast<narrow_t>(slope)), -shift)));
+    }
+
     constexpr auto align_to_y(mantissa_t accumulator, int_t shift) const noexcept -> y_t
     {
         return y_t::literal(saturate_cast<typename y_t::value_t>(shifter.shift(widen(accumulator), -shift)));
@@ -221,6 +304,7 @@ public:
     using segment_evaluator_t = t_segment_evaluator_t;
 
     using packed_segment_t = traits_t::packed_segment_t;
+    using unpacked_segment_t = segment_unpacker_t::unpacked_segment_t;
 
     using y_t = segment_evaluator_t::y_t;
 
@@ -246,6 +330,24 @@ public:
         return evaluate_segment(unpack_segment(packed_segment_), x);
     }
 
+    /// unpacks fields once so the same segment can be evaluated at several inputs
+    constexpr auto unpack() const noexcept -> unpacked_segment_t { return unpack_segment(packed_segment_); }
+
+    /// evaluates fields previously returned by unpack()
+    constexpr auto evaluate(unpacked_segment_t const& unpacked_segment, x_t x) const noexcept -> y_t
+    {
+        return evaluate_segment(unpacked_segment, x);
+    }
+
+    /// slope, dy/dx
+    constexpr auto derivative(x_t x) const noexcept -> y_t { return evaluate_with_slope(x).slope; }
+
+    /// value and slope for about the cost of the value alone; unpacks once
+    constexpr auto evaluate_with_slope(x_t x) const noexcept -> value_and_slope_t<y_t>
+    {
+        return evaluate_segment.with_slope(unpack_segment(packed_segment_), x);
+    }
+
 private:
     [[no_unique_address]] segment_unpacker_t unpack_segment;
     [[no_unique_address]] segment_evaluator_t evaluate_segment;
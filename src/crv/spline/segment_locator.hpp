@@ -8,8 +8,11 @@
 
 #include <crv/lib.hpp>
 #include <crv/math/fixed/fixed.hpp>
+#include <crv/spline/node_search.hpp>
 #include <array>
 #include <bit>
+#include <cassert>
+#include <cstddef>
 #include <span>
 
 namespace crv::spline {
@@ -25,10 +28,18 @@ namespace crv::spline {
 /// overall. It performs 3 comparisons per fetch, so it must fetch fewer times than a binary tree. Each node stores 3
 /// keys, and the top nodes of the tree are stored adjacently, so the first cache line contains the first few conditions
 /// with a single fetch.
-template <typename t_x_t, int t_depth_max> class segment_locator_t
+///
+/// The comparisons within a node are delegated to a node search. The default is chosen at compile time; see
+/// node_search.hpp.
+///
+/// depth_max only bounds capacity. The tree is built to the depth its segment count actually needs, so a spline with
+/// 40 segments descends 3 levels, not 4. Nodes are stored breadth first, so a shallower tree is a prefix of the node
+/// array, and nothing past that prefix is read or needs to be transmitted.
+template <typename t_x_t, int t_depth_max, typename t_node_search_t = node_searches::default_t> class segment_locator_t
 {
 public:
     using x_t = t_x_t;
+    using node_search_t = t_node_search_t;
     static constexpr auto depth_max = int_t{t_depth_max};
 
     static constexpr auto branching_factor = 4;
@@ -71,52 +82,111 @@ public:
         }
     };
 
-    constexpr segment_locator_t() noexcept : x_max_{}, segment_count_{}, nodes_{} {}
+    /// depth of the shallowest tree with a leaf for every segment
+    static constexpr auto depth_for(int_t segment_count) noexcept -> int_t
+    {
+        auto depth = int_t{0};
+        while (depth < depth_max && (int_t{1} << (2 * depth)) < segment_count) ++depth;
+        return depth;
+    }
+
+    /// number of nodes in a complete tree of the given depth; (4^depth - 1)/3
+    static constexpr auto node_count_at(int_t depth) noexcept -> int_t
+    {
+        return ((int_t{1} << (2 * depth)) - 1) / node_key_count;
+    }
+
+    constexpr segment_locator_t() noexcept : x_max_{}, segment_count_{}, depth_{}, nodes_{} {}
 
+    /// \pre sorted_keys at and beyond segment_count - 1 are padding, >= x_max
     explicit constexpr segment_locator_t(
         std::span<x_t const, total_key_count> sorted_keys, x_t x_max, int_t segment_count) noexcept
-        : x_max_{x_max}, segment_count_{segment_count}
+        : x_max_{x_max}, segment_count_{segment_count}, depth_{depth_for(segment_count)}, nodes_{}
     {
         // this type goes over the ioctl boundary, so it must be trivially copyable
         static_assert(std::is_trivially_copyable_v<segment_locator_t>);
 
-        // walk tree in-order and place next sorted key into each position
-        for (auto in_order_index = 1; in_order_index <= total_key_count; ++in_order_index) // 1-based
+        // walk tree in-order and place next sorted key into each position; keys past the trimmed tree are padding
+        auto const key_count = node_count_at(depth_) * node_key_count;
+        for (auto in_order_index = 1; in_order_index <= key_count; ++in_order_index) // 1-based
         {
-            auto const node_location = node_location_t{in_order_index};
+            auto const node_location = node_location_t{in_order_index, depth_};
             nodes_[node_location.node_index].keys[node_location.key_offset] = sorted_keys[in_order_index - 1];
         }
     }
 
+    /// restores a tree from the bytes of nodes()
+    ///
+    /// The result is only usable if is_valid() passes.
+    ///
+    /// \pre node_bytes.size() == node_count_at(depth_for(segment_count)) * sizeof(node_t)
+    segment_locator_t(std::span<std::byte const> node_bytes, x_t x_max, int_t segment_count) noexcept
+        : x_max_{x_max}, segment_count_{segment_count}, depth_{depth_for(segment_count)}, nodes_{}
+    {
+        assert(node_bytes.size() <= sizeof(nodes_) && "segment_locator_t: node bytes overflow tree");
+        __builtin_memcpy(nodes_.data(), node_bytes.data(), node_bytes.size());
+    }
+
+    /// changes the tree's extent in place, keeping its nodes
+    ///
+    /// Nodes that enter the trimmed tree keep whatever they held before, so the caller must overwrite them. The result
+    /// is only usable if is_valid() passes.
+    auto reshape(x_t x_max, int_t segment_count) noexcept -> void
+    {
+        x_max_ = x_max;
+        segment_count_ = segment_count;
+        depth_ = depth_for(segment_count);
+    }
+
+    /// overwrites a run of nodes in place from their bytes
+    ///
+    /// The result is only usable if is_valid() passes.
+    ///
+    /// \pre node_bytes.size() is a multiple of sizeof(node_t) and the run fits in the node array
+    auto overwrite_nodes(int_t first_node, std::span<std::byte const> node_bytes) noexcept -> void
+    {
+        assert(0 <= first_node && static_cast<std::size_t>(first_node) * sizeof(node_t) + node_bytes.size()
+                   <= sizeof(nodes_) && "segment_locator_t: node bytes overflow tree");
+        __builtin_memcpy(nodes_.data() + first_node, node_bytes.data(), node_bytes.size());
+    }
+
     constexpr auto locate(x_t x) const noexcept -> result_t
     {
-        auto index = 0;
+        auto index = int_t{0};
         auto origin = x_t{0};
 
-        for (auto depth = 0; depth < depth_max; ++depth)
+        for (auto depth = 0; depth < depth_; ++depth)
         {
-            // alias keys locally in sorted order
-            auto const key0 = nodes_[index].keys[0];
-            auto const key1 = nodes_[index].keys[1];
-            auto const key2 = nodes_[index].keys[2];
-
-            // choose lower bound key
-            origin = (x >= key0) ? key0 : origin;
-            origin = (x >= key1) ? key1 : origin;
-            origin = (x >= key2) ? key2 : origin;
+            // choose lower bound key and offset
+            auto const result = search_node(nodes_[index], x, origin);
+            origin = result.origin;
 
-            // choose lower bound offset
-            auto const child_offset = (x >= key0) + (x >= key1) + (x >= key2);
-
-            index = 4 * index + 1 + child_offset;
+            index = 4 * index + 1 + result.child_offset;
         }
 
-        return {.index = index - node_count, .origin = origin};
+        return {.index = index - node_count_at(depth_), .origin = origin};
+    }
+
+    /// start of a segment, found without descending
+    ///
+    /// \pre 0 <= segment_index < segment_count()
+    constexpr auto origin(int_t segment_index) const noexcept -> x_t
+    {
+        return segment_index == 0 ? x_t{0} : key_at(segment_index);
     }
 
     /// number of real segments; the rest of the key array is padding
     constexpr auto segment_count() const noexcept -> int_t { return segment_count_; }
 
+    /// number of levels locate() descends
+    constexpr auto depth() const noexcept -> int_t { return depth_; }
+
+    /// nodes of the trimmed tree; the rest of the node array is never read
+    constexpr auto nodes() const noexcept -> std::span<node_t const>
+    {
+        return std::span{nodes_}.first(static_cast<std::size_t>(node_count_at(depth_)));
+    }
+
     /// end of final segment
     constexpr auto x_max() const noexcept -> x_t { return x_max_; }
 
@@ -126,6 +196,9 @@ public:
         // validate segment_count is in valid range
         if (segment_count_ <= 0 || max_segment_count < segment_count_) return false;
 
+        // validate tree is trimmed to exactly the depth segment_count needs; locate() trusts depth_ to index nodes_
+        if (depth_ != depth_for(segment_count_)) return false;
+
         // validate x_max is nonnegative
         if (x_max_ <= x_t{0}) return false;
 
@@ -142,7 +215,8 @@ public:
         }
 
         // padding keys: must be >= x_max_ so descent remains structurally sound
-        for (auto i = segment_count_; i <= total_key_count; ++i)
+        auto const key_count = node_count_at(depth_) * node_key_count;
+        for (auto i = segment_count_; i <= key_count; ++i)
         {
             auto const key = key_at(i);
             if (key < previous_key) return false;
@@ -167,7 +241,7 @@ private:
         int_t node_index;
         int_t key_offset;
 
-        constexpr node_location_t(int_t in_order_index) noexcept
+        constexpr node_location_t(int_t in_order_index, int_t depth) noexcept
         {
             static constexpr auto branching_mask = branching_factor - 1;
 
@@ -188,7 +262,7 @@ private:
             auto const node_offset_in_row = key_offset_in_row >> 2; // remaining bits above low 2
 
             // depth below root; a layout property depending on tree structure
-            auto const depth_below_root = depth_max - 1 - height_above_floor;
+            auto const depth_below_root = depth - 1 - height_above_floor;
 
             node_index = row_offsets.base_index[depth_below_root] + node_offset_in_row;
             key_offset = (key_offset_in_row & branching_mask) - 1; // low 2 bits, 0-based
@@ -197,12 +271,14 @@ private:
 
     constexpr auto key_at(int_t in_order_index) const noexcept -> x_t
     {
-        auto const node_location = node_location_t{in_order_index};
+        auto const node_location = node_location_t{in_order_index, depth_};
         return nodes_[node_location.node_index].keys[node_location.key_offset];
     }
 
+    [[no_unique_address]] node_search_t search_node;
     x_t x_max_;
     int_t segment_count_;
+    int_t depth_;
     alignas(64) nodes_t nodes_;
 };
 
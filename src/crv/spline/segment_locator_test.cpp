@@ -8,6 +8,7 @@
 #include <crv/math/limits.hpp>
 #include <crv/test/test.hpp>
 #include <algorithm>
+#include <utility>
 
 namespace crv::spline {
 namespace {
@@ -188,18 +189,20 @@ static_assert(!sut_t{segments_t{10, 60, 50}, 20, 2}.is_valid());
 namespace sweep_tests {
 
 // reference implementation: count of keys <= x is the segment index; last such key is origin
-template <int_t depth_max> constexpr auto expected_result(std::span<x_t const> keys, x_t x)
+template <int_t depth_max, typename node_search_t = node_searches::default_t>
+constexpr auto expected_result(std::span<x_t const> keys, x_t x)
 {
-    using sut_t = segment_locator_t<x_t, depth_max>;
+    using sut_t = segment_locator_t<x_t, depth_max, node_search_t>;
     auto const bound = std::upper_bound(keys.begin(), keys.end(), x);
     auto const index = static_cast<int_t>(bound - keys.begin());
     auto const origin = (bound == keys.begin()) ? x_t{0} : *(bound - 1);
     return typename sut_t::result_t{.index = index, .origin = origin};
 }
 
-template <int_t depth_max> constexpr auto test_sweep(int_t offset, int_t stride) -> bool
+template <int_t depth_max, typename node_search_t = node_searches::default_t>
+constexpr auto test_sweep(int_t offset, int_t stride) -> bool
 {
-    using sut_t = segment_locator_t<x_t, depth_max>;
+    using sut_t = segment_locator_t<x_t, depth_max, node_search_t>;
     std::array<x_t, sut_t::total_key_count> keys{};
 
     // generate strided keys
@@ -214,9 +217,10 @@ template <int_t depth_max> constexpr auto test_sweep(int_t offset, int_t stride)
     {
         auto const result = sut.locate(x);
 
-        if (result != expected_result<depth_max>(keys, x)) return false;
+        if (result != expected_result<depth_max, node_search_t>(keys, x)) return false;
         if (result.origin > x) return false; // origin <= x
         if (result.index < prev_index) return false; // monotonic in x
+        if (result.origin != sut.origin(result.index)) return false; // origin agrees with locate
 
         prev_index = result.index;
     }
@@ -231,7 +235,114 @@ static_assert(test_sweep<2>(3, 5));
 static_assert(test_sweep<3>(1, 1));
 static_assert(test_sweep<4>(1, 1));
 
+// simd searches only run outside of constant evaluation
+TEST(segment_locator_test, simd_sweep)
+{
+    EXPECT_TRUE((test_sweep<1, node_searches::simd_t>(3, 5)));
+    EXPECT_TRUE((test_sweep<2, node_searches::simd_t>(3, 5)));
+    EXPECT_TRUE((test_sweep<4, node_searches::simd_t>(1, 1)));
+}
+
+// simd_t is the widest search available, so name the narrower one explicitly
+#if !defined __KERNEL__ && defined __SSE4_2__
+TEST(segment_locator_test, sse42_sweep)
+{
+    EXPECT_TRUE((test_sweep<1, node_searches::sse42_t>(3, 5)));
+    EXPECT_TRUE((test_sweep<2, node_searches::sse42_t>(3, 5)));
+    EXPECT_TRUE((test_sweep<4, node_searches::sse42_t>(1, 1)));
+}
+#endif
+
 } // namespace sweep_tests
 
+// --------------------------------------------------------------------------------------------------------------------
+// trimmed trees
+// --------------------------------------------------------------------------------------------------------------------
+
+namespace trimmed_tests {
+
+using sut_t = segment_locator_t<x_t, 4>;
+
+static_assert(sut_t::depth_for(1) == 0);
+static_assert(sut_t::depth_for(2) == 1);
+static_assert(sut_t::depth_for(4) == 1);
+static_assert(sut_t::depth_for(5) == 2);
+static_assert(sut_t::depth_for(16) == 2);
+static_assert(sut_t::depth_for(17) == 3);
+static_assert(sut_t::depth_for(40) == 3);
+static_assert(sut_t::depth_for(256) == 4);
+
+static_assert(sut_t::node_count_at(0) == 0);
+static_assert(sut_t::node_count_at(1) == 1);
+static_assert(sut_t::node_count_at(2) == 5);
+static_assert(sut_t::node_count_at(4) == sut_t::node_count);
+
+constexpr auto stride = x_t{10};
+
+constexpr auto create_sut(int_t segment_count) noexcept -> sut_t
+{
+    auto const x_max = segment_count * stride;
+    auto keys = std::array<x_t, sut_t::total_key_count>{};
+    for (auto i = 0; i < sut_t::total_key_count; ++i) keys[i] = i + 1 < segment_count ? (i + 1) * stride : x_max;
+    return sut_t{keys, x_max, segment_count};
+}
+
+// tree descends only as deep as the segment count needs, and nodes() covers exactly that tree
+constexpr auto test_trimmed(int_t segment_count) noexcept -> bool
+{
+    auto const sut = create_sut(segment_count);
+    if (!sut.is_valid()) return false;
+    if (sut.depth() != sut_t::depth_for(segment_count)) return false;
+    if (std::ssize(sut.nodes()) != sut_t::node_count_at(sut.depth())) return false;
+
+    for (auto x = x_t{0}; x < sut.x_max(); ++x)
+    {
+        auto const expected_index = x / stride;
+        if (sut.locate(x) != sut_t::result_t{expected_index, expected_index * stride}) return false;
+    }
+
+    return true;
+}
+
+static_assert(test_trimmed(1));
+static_assert(test_trimmed(2));
+static_assert(test_trimmed(4));
+static_assert(test_trimmed(5));
+static_assert(test_trimmed(40));
+static_assert(test_trimmed(64));
+static_assert(test_trimmed(65));
+static_assert(test_trimmed(256));
+
+TEST(segment_locator_test, restores_from_node_bytes)
+{
+    for (auto const segment_count : {1, 5, 40, 256})
+    {
+        auto const expected = create_sut(segment_count);
+        auto const actual = sut_t{std::as_bytes(expected.nodes()), expected.x_max(), segment_count};
+
+        EXPECT_TRUE(actual.is_valid());
+        EXPECT_EQ(expected.depth(), actual.depth());
+        for (auto x = x_t{0}; x < expected.x_max(); ++x) EXPECT_EQ(expected.locate(x), actual.locate(x));
+    }
+}
+
+TEST(segment_locator_test, updates_in_place)
+{
+    for (auto const [from, to] : {std::pair{5, 40}, std::pair{40, 5}, std::pair{40, 41}, std::pair{1, 256}})
+    {
+        auto const expected = create_sut(to);
+        auto actual = create_sut(from);
+
+        actual.reshape(expected.x_max(), to);
+        actual.overwrite_nodes(0, std::as_bytes(expected.nodes()));
+
+        EXPECT_TRUE(actual.is_valid());
+        EXPECT_EQ(expected.depth(), actual.depth());
+        for (auto x = x_t{0}; x < expected.x_max(); ++x) EXPECT_EQ(expected.locate(x), actual.locate(x));
+    }
+}
+
+} // namespace trimmed_tests
+
 } // namespace
 } // namespace crv::spline
@@ -0,0 +1,151 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief storage policies for a spline's segments
+///
+/// Segments are assembled packed, 4 fields in half a cache line, and every evaluation unpacks them: masking and sign
+/// extending each shift, and shifting each mantissa down. Storage policies choose whether that happens on every
+/// evaluation or once, when the segment is stored.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/spline/segment.hpp>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+
+namespace crv::spline {
+
+/// segments stored pre-unpacked, one array per field component
+///
+/// Evaluation reads mantissas and shifts directly, skipping the unpacker entirely, but a segment is spread over 8
+/// arrays instead of half a cache line, so a cold evaluation touches up to 8 lines instead of 1. This trades cache
+/// footprint for latency, which pays off when the spline stays hot.
+///
+/// Elements are accessed through proxies with the same evaluation interface as segment_t, so spline_t can't tell the
+/// difference. Assigning a packed segment to a proxy unpacks it into the arrays.
+template <typename t_segment_t, int_t t_size> class soa_segments_t
+{
+public:
+    using segment_t = t_segment_t;
+    using value_type = segment_t;
+    using x_t = segment_t::x_t;
+    using y_t = segment_t::y_t;
+    using unpacked_segment_t = segment_t::unpacked_segment_t;
+    using segment_evaluator_t = segment_t::segment_evaluator_t;
+    using unpacked_field_t = unpacked_segment_t::value_type;
+    using mantissa_t = unpacked_field_t::mantissa_t;
+
+    /// packed shifts are at most 7 bits
+    using shift_t = int8_t;
+
+    static constexpr auto field_count = static_cast<int_t>(std::tuple_size_v<unpacked_segment_t>);
+
+    /// view of one segment; writable when storage_t is not const
+    template <typename storage_t> class basic_reference_t
+    {
+    public:
+        constexpr basic_reference_t(storage_t& segments, int_t index) noexcept : segments_{&segments}, index_{index} {}
+
+        constexpr auto operator()(x_t x) const noexcept -> y_t { return evaluate(unpack(), x); }
+
+        /// gathers fields; this is only loads, no unpacking
+        constexpr auto unpack() const noexcept -> unpacked_segment_t
+        {
+            auto result = unpacked_segment_t{};
+            for (auto field = 0; field < field_count; ++field)
+            {
+                result[field] = unpacked_field_t{
+                    .mantissa = segments_->mantissas_[field][index_],
+                    .shift = static_cast<int_t>(segments_->shifts_[field][index_]),
+                };
+            }
+            return result;
+        }
+
+        constexpr auto evaluate(unpacked_segment_t const& unpacked_segment, x_t x) const noexcept -> y_t
+        {
+            return segments_->evaluate_segment(unpacked_segment, x);
+        }
+
+        constexpr auto derivative(x_t x) const noexcept -> y_t { return evaluate_with_slope(x).slope; }
+
+        constexpr auto evaluate_with_slope(x_t x) const noexcept -> value_and_slope_t<y_t>
+        {
+            return segments_->evaluate_segment.with_slope(unpack(), x);
+        }
+
+        /// unpacks segment into the arrays
+        constexpr auto operator=(segment_t const& segment) const noexcept -> basic_reference_t const&
+            requires(!std::is_const_v<storage_t>)
+        {
+            auto const unpacked_segment = segment.unpack();
+            for (auto field = 0; field < field_count; ++field)
+            {
+                segments_->mantissas_[field][index_] = unpacked_segment[field].mantissa;
+                segments_->shifts_[field][index_] = static_cast<shift_t>(unpacked_segment[field].shift);
+            }
+            return *this;
+        }
+
+    private:
+        storage_t* segments_;
+        int_t index_;
+    };
+
+    using reference_t = basic_reference_t<soa_segments_t>;
+    using const_reference_t = basic_reference_t<soa_segments_t const>;
+
+    constexpr auto operator[](int_t index) noexcept -> reference_t { return reference_t{*this, index}; }
+    constexpr auto operator[](int_t index) const noexcept -> const_reference_t
+    {
+        return const_reference_t{*this, index};
+    }
+
+    static constexpr auto size() noexcept -> int_t { return t_size; }
+
+    /// prefetches every component of a segment and, since they share lines, usually its neighbors
+    constexpr auto prefetch(auto const& prefetcher, int_t index) const noexcept -> void
+    {
+        // index may be one out of bounds on either side; forming these addresses through uintptr_t avoids ub
+        for (auto field = 0; field < field_count; ++field)
+        {
+            prefetcher.prefetch(element_address(mantissas_[field].data(), index));
+            prefetcher.prefetch(element_address(shifts_[field].data(), index));
+        }
+    }
+
+private:
+    template <typename element_t>
+    static auto element_address(element_t const* base, int_t index) noexcept -> void const*
+    {
+        return reinterpret_cast<void const*>(reinterpret_cast<std::uintptr_t>(base) + index * sizeof(element_t));
+    }
+
+    template <typename element_t> using component_t = std::array<std::array<element_t, t_size>, field_count>;
+
+    [[no_unique_address]] segment_evaluator_t evaluate_segment{};
+    alignas(64) component_t<mantissa_t> mantissas_{};
+    alignas(64) component_t<shift_t> shifts_{};
+};
+
+namespace segment_storages {
+
+/// segments stored as assembled; smallest footprint, unpacked on every evaluation
+struct packed_t
+{
+    template <typename segment_t, int_t size> using storage_t = std::array<segment_t, size>;
+};
+
+/// segments stored pre-unpacked; larger footprint, no unpacking during evaluation
+struct soa_t
+{
+    template <typename segment_t, int_t size> using storage_t = soa_segments_t<segment_t, size>;
+};
+
+} // namespace segment_storages
+
+} // namespace crv::spline
@@ -0,0 +1,221 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "segment_storage.hpp"
+#include <crv/spline/prod_spline.hpp>
+#include <crv/spline/spline.hpp>
+#include <crv/test/test.hpp>
+#include <array>
+#include <vector>
+
+namespace crv::spline {
+namespace {
+
+// stores its fields unpacked already
+struct segment_t
+{
+    using x_t = int_t;
+    using y_t = int_t;
+    using unpacked_segment_t = std::array<unpacked_field_t<int64_t>, fields_per_segment>;
+
+    // weights each field distinctly so any misplaced mantissa or shift changes the result
+    struct segment_evaluator_t
+    {
+        constexpr auto operator()(unpacked_segment_t const& fields, x_t x) const noexcept -> y_t
+        {
+            auto result = y_t{0};
+            for (auto const& field : fields) result = result * x + (field.mantissa << 8) + field.shift;
+            return result;
+        }
+
+        // forward difference stands in for the slope
+        constexpr auto with_slope(unpacked_segment_t const& fields, x_t x) const noexcept -> value_and_slope_t<y_t>
+        {
+            return {.value = (*this)(fields, x), .slope = (*this)(fields, x + 1) - (*this)(fields, x)};
+        }
+    };
+
+    unpacked_segment_t fields{};
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return segment_evaluator_t{}(fields, x); }
+    constexpr auto unpack() const noexcept -> unpacked_segment_t { return fields; }
+
+    constexpr auto evaluate_with_slope(x_t x) const noexcept -> value_and_slope_t<y_t>
+    {
+        return segment_evaluator_t{}.with_slope(fields, x);
+    }
+};
+
+using x_t = segment_t::x_t;
+using y_t = segment_t::y_t;
+
+constexpr auto size = 3;
+using sut_t = soa_segments_t<segment_t, size>;
+
+constexpr auto segments = std::array<segment_t, size>{{
+    {{{{1, 0}, {-2, 3}, {3, 5}, {-4, -7}}}},
+    {{{{5, 1}, {6, 2}, {-7, 0}, {8, 63}}}},
+    {{{{-9, 127}, {10, 0}, {11, 1}, {-12, -64}}}},
+}};
+
+constexpr auto create_sut() noexcept -> sut_t
+{
+    auto result = sut_t{};
+    for (auto index = 0; index < size; ++index) result[index] = segments[index];
+    return result;
+}
+
+// ====================================================================================================================
+// soa_segments_t
+// ====================================================================================================================
+
+namespace soa_segments_tests {
+
+static_assert(sut_t::size() == size);
+
+// stored segments unpack to the same fields
+static_assert([] {
+    auto const sut = create_sut();
+    for (auto index = 0; index < size; ++index)
+    {
+        if (sut[index].unpack() != segments[index].unpack()) return false;
+    }
+    return true;
+}());
+
+// stored segments evaluate the same, through both the call operator and evaluate()
+static_assert([] {
+    auto const sut = create_sut();
+    for (auto index = 0; index < size; ++index)
+    {
+        for (auto x = x_t{-3}; x <= 3; ++x)
+        {
+            if (sut[index](x) != segments[index](x)) return false;
+            if (sut[index].evaluate(sut[index].unpack(), x) != segments[index](x)) return false;
+        }
+    }
+    return true;
+}());
+
+// overwriting one segment leaves the others alone
+static_assert([] {
+    auto sut = create_sut();
+    sut[1] = segments[2];
+    return sut[0].unpack() == segments[0].unpack() && sut[1].unpack() == segments[2].unpack()
+        && sut[2].unpack() == segments[2].unpack();
+}());
+
+// storage goes over the ioctl boundary inside payloads
+static_assert(std::is_trivially_copyable_v<sut_t>);
+
+// production segments survive the round trip through int8_t shifts
+static_assert([] {
+    using prod_sut_t = soa_segments_t<prod_segment_t, 1>;
+    using packed_segment_t = prod_segment_t::packed_segment_t;
+
+    // mantissas in high bits, shifts in low 7 bits; final shift is signed, so 0x40 is -64
+    auto const segment = prod_segment_t{packed_segment_t{0xFFFFFFFFFFFFFF80 | 127, 5 << 7, 0, (3ul << 7) | 0x40}};
+
+    auto sut = prod_sut_t{};
+    sut[0] = segment;
+    return sut[0].unpack() == segment.unpack();
+}());
+
+struct tracking_prefetcher_t
+{
+    std::vector<void const*>* addresses;
+
+    auto prefetch(void const* address) const noexcept -> void { addresses->push_back(address); }
+};
+
+TEST(soa_segments_test, prefetch_touches_every_component)
+{
+    auto const sut = create_sut();
+    auto addresses = std::vector<void const*>{};
+
+    sut.prefetch(tracking_prefetcher_t{&addresses}, 1);
+
+    // 4 mantissas and 4 shifts, all distinct, all inside the storage
+    ASSERT_EQ(8u, addresses.size());
+    auto const begin = reinterpret_cast<std::byte const*>(&sut);
+    auto const end = begin + sizeof(sut);
+    for (auto const* address : addresses)
+    {
+        EXPECT_LE(begin, static_cast<std::byte const*>(address));
+        EXPECT_GT(end, static_cast<std::byte const*>(address));
+    }
+}
+
+} // namespace soa_segments_tests
+
+// ====================================================================================================================
+// spline_t
+// ====================================================================================================================
+
+namespace spline_tests {
+
+struct extended_tangent_t
+{
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return -x; }
+    constexpr auto derivative(x_t) const noexcept -> y_t { return -1; }
+};
+
+// maps subdomains of width 2 to sequential indices
+struct segment_locator_t
+{
+    static constexpr auto max_segment_count = size;
+
+    struct result_t
+    {
+        int_t index;
+        x_t origin;
+    };
+
+    constexpr auto locate(x_t x) const noexcept -> result_t { return {.index = x / 2, .origin = x / 2 * 2}; }
+    constexpr auto x_max() const noexcept -> x_t { return 2 * size; }
+    constexpr auto segment_count() const noexcept -> int_t { return size; }
+    constexpr auto is_valid() const noexcept -> bool { return true; }
+};
+
+template <typename segment_storage_t>
+using spline_t = spline_t<segment_t, extended_tangent_t, segment_locator_t, locate_hints::none_t, segment_storage_t>;
+
+template <typename segment_storage_t> constexpr auto create_spline() noexcept -> spline_t<segment_storage_t>
+{
+    auto result = spline_t<segment_storage_t>{};
+    for (auto index = 0; index < size; ++index) result.payload.segments[index] = segments[index];
+    return result;
+}
+
+// soa storage evaluates identically to packed storage
+static_assert([] {
+    auto const packed = create_spline<segment_storages::packed_t>();
+    auto const soa = create_spline<segment_storages::soa_t>();
+    for (auto x = x_t{0}; x < 2 * size + 2; ++x)
+    {
+        if (packed(x) != soa(x)) return false;
+        if (packed.evaluate_with_slope(x) != soa.evaluate_with_slope(x)) return false;
+    }
+    return true;
+}());
+
+TEST(soa_segments_test, batch_evaluation_matches_packed)
+{
+    auto const packed = create_spline<segment_storages::packed_t>();
+    auto const soa = create_spline<segment_storages::soa_t>();
+
+    auto const xs = std::array<x_t, 8>{5, 0, 3, 1, 7, 2, 4, 6};
+    auto expected = std::array<y_t, 8>{};
+    auto actual = std::array<y_t, 8>{};
+    packed.evaluate(xs, expected);
+    soa.evaluate(xs, actual);
+
+    EXPECT_EQ(expected, actual);
+}
+
+} // namespace spline_tests
+
+} // namespace
+} // namespace crv::spline
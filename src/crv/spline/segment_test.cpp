@@ -235,6 +235,73 @@ constexpr auto y_expected
 static_assert(evaluate({{{3 * 1024, 1}, {5 * 512, 2}, {7 * 128, 3}, {11 * 32, 4}}}, x_t::literal(10))
     == y_t::literal(y_expected));
 
+//
+// degree
+//
+
+static_assert(decltype(evaluate)::degree_of({{{3, 0}, {0, 0}, {0, 0}, {0, 0}}}) == 3);
+static_assert(decltype(evaluate)::degree_of({{{0, 0}, {5, 0}, {0, 0}, {0, 0}}}) == 2);
+static_assert(decltype(evaluate)::degree_of({{{0, 0}, {0, 0}, {7, 0}, {11, 0}}}) == 1);
+static_assert(decltype(evaluate)::degree_of({{{0, 0}, {0, 0}, {0, 0}, {11, 0}}}) == 0);
+static_assert(decltype(evaluate)::degree_of({{{0, 0}, {0, 0}, {0, 0}, {0, 0}}}) == 0);
+
+// skipped steps ignore their shifts, like the zero accumulator they would have shifted
+static_assert(evaluate({{{0, 5}, {0, 9}, {7, 0}, {11, 0}}}, x_t::literal(10)) == y_t::literal(81));
+static_assert(evaluate({{{0, 5}, {0, 9}, {0, 3}, {11, 0}}}, x_t::literal(10)) == y_t::literal(11));
+
+//
+// slope
+//
+
+// slopes are per whole unit of x, so raw derivatives gain x's 14 fractional bits
+constexpr auto x_one = 1 << 14;
+
+// constant
+static_assert(evaluate.with_slope({{{0, 0}, {0, 0}, {0, 0}, {11, 0}}}, x_t::literal(10))
+    == value_and_slope_t<y_t>{y_t::literal(11), y_t::literal(0)});
+
+// linear; 7
+static_assert(evaluate.with_slope({{{0, 0}, {0, 0}, {7, 0}, {11, 0}}}, x_t::literal(10))
+    == value_and_slope_t<y_t>{y_t::literal(81), y_t::literal(7 * x_one)});
+
+// cubic; 3*3*10^2 + 2*5*10 + 7 = 1007
+static_assert(evaluate.with_slope({{{3, 0}, {5, 0}, {7, 0}, {11, 0}}}, x_t::literal(10))
+    == value_and_slope_t<y_t>{y_t::literal(3581), y_t::literal(1007 * x_one)});
+
+// with shifts; same cubic as the shifted value case above, so same slope
+static_assert(evaluate.with_slope({{{3 * 1024, 1}, {5 * 512, 2}, {7 * 128, 3}, {11 * 32, 4}}}, x_t::literal(10))
+    == value_and_slope_t<y_t>{y_t::literal(y_expected), y_t::literal(1007 * x_one)});
+
+// negative; -3*3*(-10)^2 + -5*2*(-10) + -7 = -807
+static_assert(evaluate.with_slope({{{-3, 0}, {-5, 0}, {-7, 0}, {-11, 0}}}, x_t::literal(-10)).slope
+    == y_t::literal(-807 * x_one));
+
+// final shift applies to slope as to value; 7 >> 1
+static_assert(evaluate.with_slope({{{0, 0}, {0, 0}, {7, 0}, {0, 1}}}, x_t::literal(10)).slope
+    == y_t::literal(7 * x_one / 2));
+
+// saturates instead of wrapping
+static_assert(evaluate.with_slope({{{0, 0}, {0, 0}, {mantissa_t{1} << 40, 0}, {0, 0}}}, x_t::literal(1)).slope
+    == max<y_t>());
+
+// value matches plain evaluation
+static_assert([] {
+    auto const segments = std::array<unpacked_segment_t, 4>{{
+        {{{3 * 1024, 1}, {5 * 512, 2}, {7 * 128, 3}, {11 * 32, 4}}},
+        {{{0, 5}, {-5, 2}, {7, 0}, {11, -2}}},
+        {{{0, 0}, {0, 9}, {-7, 3}, {11, 1}}},
+        {{{0, 0}, {0, 0}, {0, 0}, {-11, 0}}},
+    }};
+    for (auto const& segment : segments)
+    {
+        for (auto x = -20; x <= 20; ++x)
+        {
+            if (evaluate.with_slope(segment, x_t::literal(x)).value != evaluate(segment, x_t::literal(x))) return false;
+        }
+    }
+    return true;
+}());
+
 //
 // saturation boundaries
 //
@@ -343,6 +410,15 @@ constexpr auto sut = sut_t{packed_segment};
 
 static_assert(sut(x_t::literal(x)) == y_t::literal(y_expected));
 
+// unpacking separately matches unpacking per call
+static_assert(sut.evaluate(sut.unpack(), x_t::literal(x)) == y_t::literal(y_expected));
+static_assert(sut.evaluate(sut.unpack(), x_t::literal(x + 1)) == sut(x_t::literal(x + 1)));
+
+// slope shares the unpack; 3*3*10^2 + 2*5*10 + 7 = 1007, per whole unit of x
+static_assert(sut.derivative(x_t::literal(x)) == y_t::literal(1007 << 14));
+static_assert(sut.evaluate_with_slope(x_t::literal(x))
+    == value_and_slope_t<y_t>{y_t::literal(y_expected), y_t::literal(1007 << 14)});
+
 } // namespace segment_tests
 
 } // namespace
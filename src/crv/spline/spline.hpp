@@ -7,26 +7,46 @@
 #pragma once
 
 #include <crv/lib.hpp>
+#include <crv/algorithm.hpp>
 #include <crv/math/int_traits.hpp>
+#include <crv/spline/locate_hint.hpp>
+#include <crv/spline/segment.hpp>
+#include <crv/spline/segment_storage.hpp>
 #include <array>
 #include <cassert>
+#include <span>
 
 namespace crv::spline {
 
 /// fixed-point cubic spline approximating a function over a specific domain
-template <typename t_segment_t, typename t_extended_tangent_t, typename t_segment_locator_t> class spline_t
+///
+/// Evaluation never writes the spline, so any number of readers may share one, like every source reporting through
+/// the published slot. Readers that want a locate hint or prefetching keep their own cursor_t and pass it in; single
+/// evaluations given a cursor locate their segment through the locate hint policy; see locate_hint.hpp. Batch
+/// evaluations always use the segment locator directly, because overlapping independent descents already hides their
+/// latency.
+///
+/// Segments are kept according to the segment storage policy; see segment_storage.hpp.
+template <typename t_segment_t, typename t_extended_tangent_t, typename t_segment_locator_t,
+    typename t_locate_hint_t = locate_hints::none_t, typename t_segment_storage_t = segment_storages::packed_t>
+class spline_t
 {
 public:
     using segment_t = t_segment_t;
     using extended_tangent_t = t_extended_tangent_t;
     using segment_locator_t = t_segment_locator_t;
+    using locate_hint_t = t_locate_hint_t;
+    using segment_storage_t = t_segment_storage_t;
 
     using x_t = segment_t::x_t;
     using y_t = segment_t::y_t;
 
     static constexpr auto max_segment_count = segment_locator_t::max_segment_count;
 
-    using segments_t = std::array<segment_t, max_segment_count>;
+    using segments_t = segment_storage_t::template storage_t<segment_t, max_segment_count>;
+
+    /// number of inputs evaluate() locates together before grouping them by segment
+    static constexpr auto batch_size = int_t{16};
 
     /// wire format
     struct payload_t
@@ -43,76 +63,329 @@ public:
     /// pointer or it will cause cache misses in the kernel. The composed types protect their own invariants.
     payload_t payload{};
 
+    /// one reader's locate state: the hint's memory and the segment to prefetch around
+    ///
+    /// Cursors remember which spline and which payload they were built against. Passed to any other, including the
+    /// same spline after reset(), they start over rather than carry state derived from a different locator.
+    class cursor_t
+    {
+    public:
+        /// exposes hint state, such as hit counters
+        constexpr auto locate_hint() const noexcept -> locate_hint_t const& { return locate_hint_; }
+
+        /// most recently evaluated segment, not counting the extension
+        constexpr auto prev_segment_index() const noexcept -> int_t { return prev_segment_index_; }
+
+    private:
+        friend spline_t;
+
+        spline_t const* spline_ = nullptr;
+        int_t generation_ = 0;
+        int_t prev_segment_index_ = 0;
+        [[no_unique_address]] locate_hint_t locate_hint_{};
+    };
+
     constexpr spline_t() noexcept = default;
     constexpr spline_t(payload_t payload) noexcept : payload{std::move(payload)} {}
 
-    /// \pre 0 <= x
-    constexpr auto operator()(x_t x) const noexcept -> y_t
+    /// replaces the payload in place, invalidating cursors built against the old one
+    ///
+    /// This copies payload once, straight into place, where assigning a spline constructed from it copies twice.
+    constexpr auto reset(payload_t const& payload) noexcept -> void
     {
-        assert(x_t{0} <= x && "spline_t: input out of bounds");
+        this->payload = payload;
+        ++generation_;
+    }
 
-        auto const x_max = payload.segment_locator.x_max();
+    /// \pre 0 <= x
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return evaluate_segment(locate_segment(x), x); }
 
-        // this will need to change to use an extension segment that isn't part of the array
-        if (x >= x_max) return payload.extend_final_tangent(x - x_max);
+    /// \pre 0 <= x
+    constexpr auto operator()(x_t x, cursor_t& cursor) const noexcept -> y_t
+    {
+        return evaluate_segment(locate_segment(x, cursor), x, cursor);
+    }
 
-        auto const location = payload.segment_locator.locate(x);
-        assert(0 <= location.index && location.index < payload.segment_locator.segment_count()
-            && "spline_t: located segment index out of bounds");
-        assert(0 <= location.origin && location.origin <= x && "spline_t: located segment origin out of range");
+    /// first half of operator(): finds the segment containing x
+    ///
+    /// Past x_max, the result is one past the last segment, at x_max, where the final tangent takes over. Splitting
+    /// operator() lets callers time or interleave the halves; composed, they are operator().
+    ///
+    /// \pre 0 <= x
+    constexpr auto locate_segment(x_t x) const noexcept -> segment_locator_t::result_t
+    {
+        return locate_segment(x, [&]() noexcept { return payload.segment_locator.locate(x); });
+    }
 
-        if !consteval { prev_segment_index_ = location.index; }
+    /// locate_segment(x), through cursor's hint
+    ///
+    /// \pre 0 <= x
+    constexpr auto locate_segment(x_t x, cursor_t& cursor) const noexcept -> segment_locator_t::result_t
+    {
+        return locate_segment(
+            x, [&]() noexcept { return attach(cursor).locate_hint_.locate(payload.segment_locator, x); });
+    }
+
+    /// second half of operator(): evaluates x in the segment locate_segment(x) found
+    ///
+    /// \pre location == locate_segment(x)
+    constexpr auto evaluate_segment(segment_locator_t::result_t location, x_t x) const noexcept -> y_t
+    {
+        if (location.index == payload.segment_locator.segment_count())
+        {
+            return payload.extend_final_tangent(x - location.origin);
+        }
 
         auto const& segment = payload.segments[location.index];
         return segment(x - location.origin);
     }
 
+    /// evaluate_segment(location, x), recording the segment in cursor for prefetch()
+    ///
+    /// \pre location == locate_segment(x, cursor)
+    constexpr auto evaluate_segment(segment_locator_t::result_t location, x_t x, cursor_t& cursor) const noexcept
+        -> y_t
+    {
+        if (location.index != payload.segment_locator.segment_count())
+        {
+            attach(cursor).prev_segment_index_ = location.index;
+        }
+        return evaluate_segment(location, x);
+    }
+
+    /// evaluates value and slope, dy/dx, sharing one locate and one unpack
+    ///
+    /// \pre 0 <= x
+    constexpr auto evaluate_with_slope(x_t x) const noexcept -> value_and_slope_t<y_t>
+    {
+        return evaluate_with_slope(locate_segment(x), x);
+    }
+
+    /// evaluate_with_slope(x), through cursor's hint
+    ///
+    /// \pre 0 <= x
+    constexpr auto evaluate_with_slope(x_t x, cursor_t& cursor) const noexcept -> value_and_slope_t<y_t>
+    {
+        auto const location = locate_segment(x, cursor);
+        if (location.index != payload.segment_locator.segment_count()) cursor.prev_segment_index_ = location.index;
+        return evaluate_with_slope(location, x);
+    }
+
+    /// evaluates a stream of inputs, writing outputs in input order
+    ///
+    /// Inputs are processed in batches. Each batch is located up front so the independent tree descents overlap, then
+    /// ordered by segment so each segment is unpacked once per batch rather than once per input.
+    ///
+    /// \pre xs.size() == ys.size()
+    /// \pre 0 <= xs[i]
+    constexpr auto evaluate(std::span<x_t const> xs, std::span<y_t> ys) const noexcept -> void
+    {
+        assert(xs.size() == ys.size() && "spline_t: input and output sizes differ");
+
+        auto const size = static_cast<int_t>(xs.size());
+        for (auto first = int_t{0}; first < size; first += batch_size)
+        {
+            auto const count = static_cast<std::size_t>(min(batch_size, size - first));
+            evaluate_batch(xs.subspan(static_cast<std::size_t>(first), count),
+                ys.subspan(static_cast<std::size_t>(first), count));
+        }
+    }
+
     /// validates data the driver receives
     constexpr auto is_valid() const noexcept -> bool
     {
         // this type goes over the ioctl boundary, so it must be trivially copyable
         static_assert(std::is_trivially_copyable_v<spline_t>);
 
-        auto const segment_count = payload.segment_locator.segment_count();
+        // dispatch to segment locator
+        return payload.segment_locator.is_valid();
+    }
 
-        // prev_segment_index_ must be in [0, locator.segment_count()); locator.is_valid() owns the count's range check
-        if (prev_segment_index_ < 0 || segment_count <= prev_segment_index_) return false;
+    /// prefetches around the first segment
+    constexpr auto prefetch(auto const& prefetcher) const noexcept -> void { prefetch(prefetcher, int_t{0}); }
 
-        // dispatch to segment locator
-        if (!payload.segment_locator.is_valid()) return false;
+    /// prefetches around the segment cursor last evaluated
+    constexpr auto prefetch(auto const& prefetcher, cursor_t const& cursor) const noexcept -> void
+    {
+        prefetch(prefetcher, is_attached(cursor) ? cursor.prev_segment_index_ : int_t{0});
+    }
+
+private:
+    // batch keys hold the segment index above the input's position within the batch, so sorting them groups by segment
+    static constexpr auto batch_position_bits = 8;
+    static_assert(batch_size <= (1 << batch_position_bits));
+
+    using batch_keys_t = std::array<int_t, batch_size>;
+    using batch_origins_t = std::array<x_t, batch_size>;
+
+    constexpr auto is_attached(cursor_t const& cursor) const noexcept -> bool
+    {
+        return cursor.spline_ == this && cursor.generation_ == generation_;
+    }
 
-        return true;
+    /// starts cursor over if it was built against another spline or payload
+    constexpr auto attach(cursor_t& cursor) const noexcept -> cursor_t&
+    {
+        if (!is_attached(cursor))
+        {
+            cursor = cursor_t{};
+            cursor.spline_ = this;
+            cursor.generation_ = generation_;
+        }
+        return cursor;
     }
 
-    constexpr auto prefetch(auto const& prefetcher) const noexcept -> void
+    /// handles the extension, then locates in the segments with locate
+    constexpr auto locate_segment(x_t x, auto const& locate) const noexcept -> segment_locator_t::result_t
     {
-        prefetch_segments(prefetcher);
+        assert(x_t{0} <= x && "spline_t: input out of bounds");
+
+        auto const x_max = payload.segment_locator.x_max();
+
+        // this will need to change to use an extension segment that isn't part of the array
+        if (x >= x_max) return {.index = payload.segment_locator.segment_count(), .origin = x_max};
+
+        auto const location = locate();
+        assert(0 <= location.index && location.index < payload.segment_locator.segment_count()
+            && "spline_t: located segment index out of bounds");
+        assert(0 <= location.origin && location.origin <= x && "spline_t: located segment origin out of range");
+
+        return location;
+    }
+
+    /// \pre location == locate_segment(x)
+    constexpr auto evaluate_with_slope(segment_locator_t::result_t location, x_t x) const noexcept
+        -> value_and_slope_t<y_t>
+    {
+        if (location.index == payload.segment_locator.segment_count())
+        {
+            auto const& extend_final_tangent = payload.extend_final_tangent;
+            auto const dx = x - location.origin;
+            return {.value = extend_final_tangent(dx), .slope = extend_final_tangent.derivative(dx)};
+        }
+
+        auto const& segment = payload.segments[location.index];
+        return segment.evaluate_with_slope(x - location.origin);
+    }
+
+    constexpr auto prefetch(auto const& prefetcher, int_t segment_index) const noexcept -> void
+    {
+        prefetch_segments(prefetcher, segment_index);
         payload.segment_locator.prefetch(prefetcher);
         prefetcher.prefetch(&payload.extend_final_tangent);
     }
 
-private:
+    /// \pre xs.size() == ys.size() <= batch_size
+    constexpr auto evaluate_batch(std::span<x_t const> xs, std::span<y_t> ys) const noexcept -> void
+    {
+        auto const x_max = payload.segment_locator.x_max();
+        auto const count = static_cast<int_t>(xs.size());
+
+        // locate everything first; the descents do not depend on each other, so they overlap
+        auto keys = batch_keys_t{};
+        auto origins = batch_origins_t{};
+        auto key_count = int_t{0};
+        for (auto position = int_t{0}; position < count; ++position)
+        {
+            auto const x = xs[position];
+            assert(x_t{0} <= x && "spline_t: input out of bounds");
+
+            if (x >= x_max)
+            {
+                ys[position] = payload.extend_final_tangent(x - x_max);
+                continue;
+            }
+
+            auto const location = payload.segment_locator.locate(x);
+            assert(0 <= location.index && location.index < payload.segment_locator.segment_count()
+                && "spline_t: located segment index out of bounds");
+            assert(0 <= location.origin && location.origin <= x && "spline_t: located segment origin out of range");
+
+            origins[position] = location.origin;
+            keys[key_count++] = (location.index << batch_position_bits) | position;
+        }
+
+        // group by segment
+        //
+        // Batches are small and mouse input is nearly sorted by velocity already, so insertion sort is both cheap and
+        // usually linear.
+        for (auto unsorted = int_t{1}; unsorted < key_count; ++unsorted)
+        {
+            auto const key = keys[unsorted];
+            auto sorted = unsorted;
+            for (; sorted > 0 && key < keys[sorted - 1]; --sorted) keys[sorted] = keys[sorted - 1];
+            keys[sorted] = key;
+        }
+
+        // evaluate each run of inputs sharing a segment
+        for (auto run = int_t{0}; run < key_count;) run = evaluate_run(keys, key_count, run, xs, origins, ys);
+    }
+
+    /// evaluates consecutive keys that share a segment, unpacking it once if the segment supports it
+    ///
+    /// \returns index of first key in the next run
+    constexpr auto evaluate_run(batch_keys_t const& keys, int_t key_count, int_t run, std::span<x_t const> xs,
+        batch_origins_t const& origins, std::span<y_t> ys) const noexcept -> int_t
+    {
+        auto const segment_index = keys[run] >> batch_position_bits;
+        auto const& segment = payload.segments[segment_index];
+        auto const is_in_run
+            = [&](int_t key_index) noexcept { return (keys[key_index] >> batch_position_bits) == segment_index; };
+        auto const position_of = [&](int_t key_index) noexcept {
+            return keys[key_index] & ((int_t{1} << batch_position_bits) - 1);
+        };
+
+        if constexpr (requires { segment.evaluate(segment.unpack(), x_t{}); })
+        {
+            auto const unpacked_segment = segment.unpack();
+            for (; run < key_count && is_in_run(run); ++run)
+            {
+                auto const position = position_of(run);
+                ys[position] = segment.evaluate(unpacked_segment, xs[position] - origins[position]);
+            }
+        }
+        else
+        {
+            for (; run < key_count && is_in_run(run); ++run)
+            {
+                auto const position = position_of(run);
+                ys[position] = segment(xs[position] - origins[position]);
+            }
+        }
+
+        return run;
+    }
+
     /// prefetches the most recently selected segment and the two adjacent
     ///
     /// Prefetching these 3 segments serves as our hint to exploit the natural temporal locality of mouse velocity.
-    auto prefetch_segments(auto const& prefetcher) const noexcept -> void
+    auto prefetch_segments(auto const& prefetcher, int_t prev_segment_index) const noexcept -> void
     {
-        // these casts are required to prevent ub when forming addresses outside of the array
-        auto const base_address = reinterpret_cast<std::uintptr_t>(payload.segments.data());
-        auto const offset = sizeof(segment_t);
+        // storage that isn't a plain array knows its own layout
+        if constexpr (requires { payload.segments.prefetch(prefetcher, prev_segment_index); })
+        {
+            payload.segments.prefetch(prefetcher, prev_segment_index);
+        }
+        else
+        {
+            // these casts are required to prevent ub when forming addresses outside of the array
+            auto const base_address = reinterpret_cast<std::uintptr_t>(payload.segments.data());
+            auto const offset = sizeof(segment_t);
 
-        // prefetch most recent segment
-        //
-        // Because segments_ is aligned to a cache line, one of these two will contain the cache line containing the
-        // previous segment and one adjacent, and the other will contain the other adjacent. If prev_segment_index is 0
-        // or segment_count_ - 1, these both technically are out of bounds, either prefetching the end of the segment
-        // locator or whatever follows this type as a whole, but prefetching is built to be resiliant to this pattern.
-        // We do not have to guard it with an condition, saving a pair of misprediction sources.
-        prefetcher.prefetch(reinterpret_cast<void const*>(base_address + (prev_segment_index_ - 1) * offset));
-        prefetcher.prefetch(reinterpret_cast<void const*>(base_address + (prev_segment_index_ + 1) * offset));
+            // prefetch most recent segment
+            //
+            // Because segments_ is aligned to a cache line, one of these two will contain the cache line containing the
+            // previous segment and one adjacent, and the other will contain the other adjacent. If prev_segment_index
+            // is 0 or segment_count_ - 1, these both technically are out of bounds, either prefetching the end of the
+            // segment locator or whatever follows this type as a whole, but prefetching is built to be resiliant to
+            // this pattern. We do not have to guard it with an condition, saving a pair of misprediction sources.
+            prefetcher.prefetch(reinterpret_cast<void const*>(base_address + (prev_segment_index - 1) * offset));
+            prefetcher.prefetch(reinterpret_cast<void const*>(base_address + (prev_segment_index + 1) * offset));
+        }
     }
 
-    mutable int_t prev_segment_index_ = 0;
+    /// bumped by reset() so cursors notice a new payload in the same spline
+    int_t generation_ = 0;
 };
 
 } // namespace crv::spline
@@ -89,6 +89,281 @@ static_assert(sut(6) == -41); // -40 - (5 - 6)
 // extended base_val is -40, result should be -40 - 122 = -162.
 static_assert(sut(max<x_t>()) == -162);
 
+// locate and evaluate split operator() in two
+static_assert(sut.locate_segment(3) == segment_locator_t::result_t{.index = 1, .origin = 2});
+static_assert(sut.evaluate_segment(sut.locate_segment(3), 3) == 21);
+
+// past x_max, locate lands one past the last segment, at x_max
+static_assert(sut.locate_segment(6) == segment_locator_t::result_t{.index = segment_count, .origin = x_max});
+static_assert(sut.evaluate_segment(sut.locate_segment(6), 6) == -41);
+
+// ====================================================================================================================
+// batch evaluation
+// ====================================================================================================================
+
+namespace batch_tests {
+
+// evaluates inputs as a batch, then compares each output to evaluating them one at a time
+template <std::size_t size> constexpr auto matches_scalar(std::array<x_t, size> const& xs) noexcept -> bool
+{
+    auto ys = std::array<y_t, size>{};
+    sut.evaluate(xs, ys);
+    for (auto index = 0u; index < size; ++index)
+    {
+        if (ys[index] != sut(xs[index])) return false;
+    }
+    return true;
+}
+
+// empty
+static_assert(matches_scalar(std::array<x_t, 0>{}));
+
+// unsorted and repeated segments, mixed with the extension
+static_assert(matches_scalar(std::array<x_t, 9>{4, 0, 3, 6, 1, 4, 2, 5, max<x_t>()}));
+
+// several full batches and a partial tail
+constexpr auto multiple_batches = []() noexcept {
+    auto result = std::array<x_t, 2 * sut_t::batch_size + 3>{};
+    for (auto index = 0u; index < result.size(); ++index) result[index] = static_cast<x_t>((result.size() - index) % 7);
+    return result;
+}();
+static_assert(matches_scalar(multiple_batches));
+
+} // namespace batch_tests
+
+struct spline_batch_test_t : Test
+{
+    // counts how often it is unpacked
+    struct segment_t
+    {
+        using x_t = x_t;
+        using y_t = y_t;
+
+        struct unpacked_segment_t
+        {
+            y_t base_val;
+        };
+
+        y_t base_val;
+        int_t* unpack_count;
+
+        auto operator()(x_t x) const noexcept -> y_t { return evaluate(unpack(), x); }
+
+        auto unpack() const noexcept -> unpacked_segment_t
+        {
+            ++*unpack_count;
+            return {base_val};
+        }
+
+        auto evaluate(unpacked_segment_t unpacked_segment, x_t x) const noexcept -> y_t
+        {
+            return static_cast<y_t>(unpacked_segment.base_val + x);
+        }
+    };
+
+    using sut_t = spline_t<segment_t, extended_tangent_t, segment_locator_t>;
+
+    int_t unpack_count = 0;
+    sut_t sut{sut_t::payload_t{segment_locator_t{x_max, segment_count},
+        {{{10, &unpack_count}, {20, &unpack_count}, {30, &unpack_count}}}, extended_tangent}};
+};
+
+TEST_F(spline_batch_test_t, unpacks_each_segment_once_per_batch)
+{
+    auto const xs = std::array<x_t, 8>{0, 3, 1, 2, 4, 0, 6, 1};
+    auto ys = std::array<y_t, xs.size()>{};
+
+    sut.evaluate(xs, ys);
+
+    EXPECT_EQ(3, unpack_count);
+    EXPECT_THAT(ys, ElementsAre(10, 21, 11, 20, 30, 10, -41, 11));
+}
+
+TEST_F(spline_batch_test_t, unpacks_again_in_each_batch)
+{
+    auto xs = std::array<x_t, 2 * sut_t::batch_size + 1>{};
+    auto ys = std::array<y_t, xs.size()>{};
+
+    sut.evaluate(xs, ys);
+
+    EXPECT_EQ(3, unpack_count);
+    EXPECT_THAT(ys, Each(10));
+}
+
+// ====================================================================================================================
+// locate hints
+// ====================================================================================================================
+
+namespace locate_hint_tests {
+
+// counts locates routed through the hint
+struct counting_hint_t
+{
+    int_t locate_count = 0;
+
+    constexpr auto locate(segment_locator_t const& segment_locator, x_t x) noexcept -> segment_locator_t::result_t
+    {
+        ++locate_count;
+        return segment_locator.locate(x);
+    }
+
+    constexpr auto is_valid(segment_locator_t const&) const noexcept -> bool { return true; }
+};
+
+template <typename locate_hint_t>
+using hinted_sut_t = spline_t<segment_t, extended_tangent_t, segment_locator_t, locate_hint_t>;
+
+using counting_sut_t = hinted_sut_t<counting_hint_t>;
+using cursor_t = counting_sut_t::cursor_t;
+
+constexpr auto create_hinted_sut() noexcept -> counting_sut_t
+{
+    return counting_sut_t{
+        counting_sut_t::payload_t{segment_locator_t{x_max, segment_count}, segments, extended_tangent}};
+}
+
+// cursors work in constant evaluation, too
+static_assert([] {
+    auto const sut = create_hinted_sut();
+    auto cursor = cursor_t{};
+    return sut(3, cursor) == 21 && cursor.locate_hint().locate_count == 1 && cursor.prev_segment_index() == 1;
+}());
+
+TEST(spline_locate_hint_test, single_evaluations_locate_through_cursor_hint)
+{
+    auto const sut = create_hinted_sut();
+    auto cursor = cursor_t{};
+
+    EXPECT_EQ(11, sut(1, cursor));
+    EXPECT_EQ(21, sut(3, cursor));
+    EXPECT_EQ(2, cursor.locate_hint().locate_count);
+    EXPECT_EQ(1, cursor.prev_segment_index());
+
+    // extension does not locate, nor move the prefetch index
+    EXPECT_EQ(-41, sut(6, cursor));
+    EXPECT_EQ(2, cursor.locate_hint().locate_count);
+    EXPECT_EQ(1, cursor.prev_segment_index());
+}
+
+TEST(spline_locate_hint_test, evaluations_without_cursor_bypass_hint)
+{
+    auto const sut = create_hinted_sut();
+    auto cursor = cursor_t{};
+    sut(1, cursor);
+
+    auto const xs = std::array<x_t, 3>{0, 2, 4};
+    auto ys = std::array<y_t, 3>{};
+    sut.evaluate(xs, ys);
+    EXPECT_EQ((std::array<y_t, 3>{10, 20, 30}), ys);
+    EXPECT_EQ(21, sut(3));
+
+    EXPECT_EQ(1, cursor.locate_hint().locate_count);
+    EXPECT_EQ(0, cursor.prev_segment_index());
+}
+
+TEST(spline_locate_hint_test, cursors_are_per_reader)
+{
+    auto const sut = create_hinted_sut();
+    auto cursors = std::array<cursor_t, 2>{};
+
+    sut(1, cursors[0]);
+    sut(3, cursors[1]);
+    sut(4, cursors[1]);
+
+    EXPECT_EQ(1, cursors[0].locate_hint().locate_count);
+    EXPECT_EQ(0, cursors[0].prev_segment_index());
+    EXPECT_EQ(2, cursors[1].locate_hint().locate_count);
+    EXPECT_EQ(2, cursors[1].prev_segment_index());
+}
+
+TEST(spline_locate_hint_test, reset_starts_cursors_over)
+{
+    auto sut = create_hinted_sut();
+    auto cursor = cursor_t{};
+    sut(3, cursor);
+    ASSERT_EQ(1, cursor.locate_hint().locate_count);
+
+    auto payload = sut.payload;
+    payload.extend_final_tangent = extended_tangent_t{-50};
+    sut.reset(payload);
+
+    EXPECT_EQ(-51, sut(6, cursor));
+    EXPECT_EQ(11, sut(1, cursor));
+    EXPECT_EQ(1, cursor.locate_hint().locate_count);
+    EXPECT_EQ(0, cursor.prev_segment_index());
+}
+
+TEST(spline_locate_hint_test, cursors_start_over_on_another_spline)
+{
+    auto const suts = std::array{create_hinted_sut(), create_hinted_sut()};
+    auto cursor = cursor_t{};
+    suts[0](3, cursor);
+    ASSERT_EQ(1, cursor.locate_hint().locate_count);
+
+    EXPECT_EQ(11, suts[1](1, cursor));
+    EXPECT_EQ(1, cursor.locate_hint().locate_count);
+    EXPECT_EQ(0, cursor.prev_segment_index());
+}
+
+} // namespace locate_hint_tests
+
+// ====================================================================================================================
+// slope
+// ====================================================================================================================
+
+namespace slope_tests {
+
+// adds dx to a distinct base_val, with a distinct slope per segment
+struct segment_t
+{
+    using x_t = x_t;
+    using y_t = y_t;
+
+    y_t base_val;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return static_cast<y_t>(base_val + x); }
+
+    constexpr auto evaluate_with_slope(x_t x) const noexcept -> value_and_slope_t<y_t>
+    {
+        return {.value = (*this)(x), .slope = static_cast<y_t>(base_val / 10)};
+    }
+};
+
+// subtracts dx from a distinct base_val
+struct extended_tangent_t
+{
+    y_t base_val;
+
+    constexpr auto operator()(x_t x) const noexcept -> y_t { return static_cast<y_t>(base_val - x); }
+    constexpr auto derivative(x_t) const noexcept -> y_t { return y_t{-1}; }
+};
+
+using sut_t = spline_t<segment_t, extended_tangent_t, segment_locator_t>;
+using result_t = value_and_slope_t<y_t>;
+
+constexpr auto sut = sut_t{sut_t::payload_t{
+    segment_locator_t{x_max, segment_count}, {{{10}, {20}, {30}}}, extended_tangent_t{-40}}};
+
+// segments
+static_assert(sut.evaluate_with_slope(1) == result_t{11, 1});
+static_assert(sut.evaluate_with_slope(3) == result_t{21, 2});
+static_assert(sut.evaluate_with_slope(4) == result_t{30, 3});
+
+// extended final tangent
+static_assert(sut.evaluate_with_slope(5) == result_t{-40, -1});
+static_assert(sut.evaluate_with_slope(6) == result_t{-41, -1});
+
+// value matches plain evaluation
+static_assert([] {
+    for (auto x = x_t{0}; x < 10; ++x)
+    {
+        if (sut.evaluate_with_slope(x).value != sut(x)) return false;
+    }
+    return true;
+}());
+
+} // namespace slope_tests
+
 // ====================================================================================================================
 // prefetch
 // ====================================================================================================================
@@ -182,7 +457,7 @@ TEST_F(spline_prefetch_test_t, initial_state_prefetches_adjacents_at_head)
     EXPECT_EQ(expected_fetch_distance, actual_distance);
 }
 
-TEST_F(spline_prefetch_test_t, mutates_index_and_prefetches_new_adjacents)
+TEST_F(spline_prefetch_test_t, cursor_moves_index_and_prefetches_new_adjacents)
 {
     // prefetch initial to find location of segments
     EXPECT_CALL(mock_locator, prefetch(Ref(mock_prefetcher)));
@@ -196,13 +471,14 @@ TEST_F(spline_prefetch_test_t, mutates_index_and_prefetches_new_adjacents)
     sut.prefetch(prefetcher);
     auto const* segments = static_cast<std::byte const*>(initial_prefetched_cache_lines[0]) + sizeof(segment_t);
 
-    // call into sut to get it to cache a new previous segment; previous_cache_line_ should become 2
+    // evaluate through a cursor to get it to cache a new previous segment; its index should become 2
     auto const x = x_t{expected_segment};
     EXPECT_CALL(mock_locator, locate(x))
         .WillOnce(Return(segment_locator_t::result_t{.index = expected_segment, .origin = 0}));
-    sut(x);
+    auto cursor = sut_t::cursor_t{};
+    sut(x, cursor);
 
-    // prefetch again to see that previous_cache_line_ moved correctly
+    // prefetch again to see that the cursor's index moved correctly
     EXPECT_CALL(mock_locator, prefetch(Ref(mock_prefetcher)));
 
     void const* prefetched_cache_lines[3];
@@ -213,7 +489,7 @@ TEST_F(spline_prefetch_test_t, mutates_index_and_prefetches_new_adjacents)
         EXPECT_CALL(mock_prefetcher, prefetch(_)).WillOnce(SaveArg<0>(&prefetched_cache_lines[2]));
     }
 
-    sut.prefetch(prefetcher);
+    sut.prefetch(prefetcher, cursor);
 
     auto const actual_distance = static_cast<std::byte const*>(prefetched_cache_lines[1])
         - static_cast<std::byte const*>(prefetched_cache_lines[0]);
@@ -246,6 +522,24 @@ TEST_F(spline_death_test_t, call_operator_catches_negative_x)
         (sut_t{sut_t::payload_t{segment_locator_t{}, segments, extended_tangent}}(x_t{-1})), "input out of bounds");
 }
 
+TEST_F(spline_death_test_t, evaluate_catches_negative_x)
+{
+    auto const sut = sut_t{sut_t::payload_t{segment_locator_t{}, segments, extended_tangent}};
+    auto const xs = std::array<x_t, 2>{0, -1};
+    auto ys = std::array<y_t, 2>{};
+
+    EXPECT_DEATH(sut.evaluate(xs, ys), "input out of bounds");
+}
+
+TEST_F(spline_death_test_t, evaluate_catches_mismatched_sizes)
+{
+    auto const sut = sut_t{sut_t::payload_t{segment_locator_t{}, segments, extended_tangent}};
+    auto const xs = std::array<x_t, 2>{};
+    auto ys = std::array<y_t, 1>{};
+
+    EXPECT_DEATH(sut.evaluate(xs, ys), "sizes differ");
+}
+
 // --------------------------------------------------------------------------------------------------------------------
 // call operator interactions with segment_locator_t
 // --------------------------------------------------------------------------------------------------------------------
@@ -8,6 +8,7 @@
 
 #include <crv/lib.hpp>
 #include <crv/algorithm.hpp>
+#include <crv/math/saturate_cast.hpp>
 #include <crv/math/shifter.hpp>
 
 namespace crv::spline {
@@ -37,6 +38,18 @@ struct extended_tangent_t
         auto const narrow_product = shifter.template shr<typename y_t::value_t>(wide_product, slope.shift);
         return y_t::literal(add_wrap(narrow_product, y0.value));
     }
+
+    /// dy/dx; flat past x_max_delta, where the tangent is clipped
+    ///
+    /// \param x position relative to end of segment
+    constexpr auto derivative(x_t x) const noexcept -> y_t
+    {
+        if (x.value >= x_max_delta.value) return y_t{0};
+
+        // y = mantissa*x >> shift in raw units; per whole unit of x, that is mantissa << (x_t::frac_bits - shift)
+        auto const wide_slope = shifter.shift(widen(slope.mantissa), x_t::frac_bits - slope.shift);
+        return y_t::literal(saturate_cast<typename y_t::value_t>(wide_slope));
+    }
 };
 
 } // namespace crv::spline
@@ -48,5 +48,31 @@ static_assert(
 static_assert(
     sut_t{.slope = {.mantissa = 1LL << 30, .shift = 19}, .y0 = y_t{0}, .x_max_delta = x_t{5}}(x_t{10}) == y_t{5});
 
+//
+// derivative
+//
+
+// constant slope
+static_assert(
+    sut_t{.slope = {.mantissa = 0, .shift = 0}, .y0 = y_t{3}, .x_max_delta = x_inf}.derivative(x_t{5}) == y_t{0});
+
+// positive slope
+static_assert(
+    sut_t{.slope = {.mantissa = 1LL << 30, .shift = 19}, .y0 = y_t{0}, .x_max_delta = x_inf}.derivative(x_t{5})
+    == y_t{1});
+
+// negative slope; -0.5 with 25 fractional bits
+static_assert(
+    sut_t{.slope = {.mantissa = -(1LL << 30), .shift = 20}, .y0 = y_t{4}, .x_max_delta = x_inf}.derivative(x_t{2})
+    == y_t::literal(-(1LL << 24)));
+
+// flat past the clamp
+static_assert(
+    sut_t{.slope = {.mantissa = 1LL << 30, .shift = 19}, .y0 = y_t{0}, .x_max_delta = x_t{5}}.derivative(x_t{3})
+    == y_t{1});
+static_assert(
+    sut_t{.slope = {.mantissa = 1LL << 30, .shift = 19}, .y0 = y_t{0}, .x_max_delta = x_t{5}}.derivative(x_t{5})
+    == y_t{0});
+
 } // namespace
 } // namespace crv::spline
@@ -5,16 +5,18 @@
 
 #include <crv/lib.hpp>
 #include <crv/math/fixed/exp2.hpp>
+#include <crv/math/fixed/prod_exp2.hpp>
 #include <crv/test/accuracy/accuracy_test_runner.hpp>
 #include <cmath>
 #include <cstdlib>
+#include <iostream>
 
 namespace crv {
 namespace {
 
-struct exp2_test_t
+template <typename t_impl_t> struct exp2_test_t
 {
-    using impl_t = exp2_normalized_q64_to_q1_63_t;
+    using impl_t = t_impl_t;
     using in_t = impl_t::in_t;
     using out_t = impl_t::out_t;
     using reference_t = reference_float_t;
@@ -69,7 +71,11 @@ struct exp2_test_t
 
 auto main(int, char*[]) -> int
 {
-    exp2_test_t{}();
+    std::cout << "exp2_normalized_q64_to_q1_63_t:\n";
+    exp2_test_t<exp2_normalized_q64_to_q1_63_t>{}();
+
+    std::cout << "prod_exp2_t:\n";
+    exp2_test_t<prod_exp2_t>{}();
     return EXIT_SUCCESS;
 }
 
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief accuracy of log2_t over q32.32 inputs, normalization included
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/log2.hpp>
+#include <crv/test/accuracy/accuracy_test_runner.hpp>
+#include <cmath>
+#include <cstdlib>
+
+namespace crv {
+namespace {
+
+struct log2_test_t
+{
+    using in_t = fixed_t<uint64_t, 32>;
+
+    // log2 of q32.32 is in [-32, 32], which leaves 56 fractional bits
+    using out_t = fixed_t<int64_t, 56>;
+    using reference_t = reference_float_t;
+
+    using error_metrics_t = error_metrics_t<
+        error_metrics_policy_t<in_t, reference_t, out_t, error_metric::mono_dir_policies::ascending_t>>;
+
+    auto operator()() noexcept -> void
+    {
+        using range_t = sweep_range_t<in_t>;
+
+        auto const approx_impl = [](in_t x) { return log2_t{}.eval<out_t::value_t, out_t::frac_bits>(x); };
+        auto const ref_impl = [](reference_t const& x) { return std::log2(x); };
+
+        auto const runner
+            = accuracy_test_runner_t<decltype(approx_impl), decltype(ref_impl), error_metrics_t>{approx_impl, ref_impl};
+
+        auto const max_val = crv::max<uint64_t>();
+        auto const one_val = in_t{1}.value;
+
+        // Domain is (0, max], so start at 1
+        auto const min = in_t::literal(1);
+        auto const max = in_t::literal(max_val);
+
+        auto const iterations = 10'000'000ull;
+        auto const coarse_step = in_t::literal(max_val / iterations);
+
+        range_t uniform_ranges[] = {
+            // one octave, [1, 2), is everything the polynomial sees
+            {in_t{1}, in_t{2}, in_t::literal(one_val / iterations)},
+
+            // Full span
+            {min, max, coarse_step},
+
+            // Dense uniform sweeps target the normalization boundaries
+            {min, in_t::literal(iterations), in_t::literal(1)}, // Smallest inputs, where few bits are significant
+            {in_t::literal(one_val - iterations / 2), in_t::literal(one_val + iterations / 2),
+                in_t::literal(1)}, // log2 crosses 0
+            {in_t::literal(2 * one_val - iterations / 2), in_t::literal(2 * one_val + iterations / 2),
+                in_t::literal(1)}, // Octave boundary at 2
+            {in_t::literal(max_val - iterations), max, in_t::literal(1)} // Upper limit
+        };
+
+        for (auto const& range : uniform_ranges) { runner.run_uniform(range); }
+
+        range_t fuzzed_ranges[] = {{min, max, in_t::literal(coarse_step.value * 2)}};
+
+        for (auto const& range : fuzzed_ranges) { runner.run_fuzzed(range); }
+    }
+};
+
+auto main(int, char*[]) -> int
+{
+    log2_test_t{}();
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+} // namespace crv
+
+auto main(int arg_count, char* args[]) -> int
+{
+    return crv::main(arg_count, args);
+}
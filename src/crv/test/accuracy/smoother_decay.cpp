@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief accuracy of the velocity smoother's decay factor, 2^-x - 1 over all elapsed half-lives
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/input/smoother.hpp>
+#include <crv/test/accuracy/accuracy_test_runner.hpp>
+#include <cmath>
+#include <cstdlib>
+
+namespace crv {
+namespace {
+
+struct smoother_decay_test_t
+{
+    using smoother_t = input::smoother_t<fixed_t<int64_t, 42>>;
+    using in_t = smoother_t::elapsed_t;
+    using out_t = smoother_t::decay_m1_t;
+    using reference_t = reference_float_t;
+
+    using error_metrics_t = error_metrics_t<
+        error_metrics_policy_t<in_t, reference_t, out_t, error_metric::mono_dir_policies::descending_t>>;
+
+    auto operator()() noexcept -> void
+    {
+        using range_t = sweep_range_t<in_t>;
+
+        auto const approx_impl = [](in_t elapsed) { return smoother_t::decay_m1(elapsed); };
+        auto const ref_impl = [](reference_t const& x) { return std::exp2(-x) - static_cast<reference_t>(1.0); };
+
+        auto const runner
+            = accuracy_test_runner_t<decltype(approx_impl), decltype(ref_impl), error_metrics_t>{approx_impl, ref_impl};
+
+        auto const iterations = 10'000'000ull;
+        auto const one = in_t{1}.value;
+
+        // everything past 64 half-lives decays to exactly -1
+        auto const max = in_t{64};
+        auto const coarse_step = in_t::literal(max.value / iterations);
+
+        range_t uniform_ranges[] = {
+            // first half-life, where typical intervals against typical half-lives land
+            {in_t::literal(0), in_t{1}, in_t::literal(one / iterations)},
+
+            // whole-number boundaries, where the shift takes over from the polynomial
+            {in_t::literal(one - iterations / 2), in_t::literal(one + iterations / 2), in_t::literal(1)},
+            {in_t::literal(2 * one - iterations / 2), in_t::literal(2 * one + iterations / 2), in_t::literal(1)},
+
+            // whole range
+            {in_t::literal(0), max, coarse_step},
+        };
+
+        for (auto const& range : uniform_ranges) { runner.run_uniform(range); }
+
+        range_t fuzzed_ranges[] = {
+            {in_t::literal(0), max, in_t::literal(coarse_step.value * 2)},
+        };
+
+        for (auto const& range : fuzzed_ranges) { runner.run_fuzzed(range); }
+    }
+};
+
+auto main(int, char*[]) -> int
+{
+    smoother_decay_test_t{}();
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+} // namespace crv
+
+auto main(int arg_count, char* args[]) -> int
+{
+    return crv::main(arg_count, args);
+}
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/double_buffer.hpp>
+#include <crv/test/test.hpp>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace crv {
+namespace {
+
+struct double_buffer_stress_test_t : Test
+{
+    // large enough that a torn copy would be spread over many cache lines, like a spline payload
+    struct value_t
+    {
+        std::array<int64_t, 2048> generations{};
+
+        auto fill(int64_t generation) noexcept -> void { std::ranges::fill(generations, generation); }
+    };
+
+    // yields instead of spinning so readers make progress on machines with fewer cores than threads
+    struct wait_t
+    {
+        auto operator()() const noexcept -> void { std::this_thread::yield(); }
+    };
+
+    using sut_t = double_buffer_t<value_t, wait_t>;
+
+    static constexpr auto reader_count = 4;
+    static constexpr auto duration = std::chrono::milliseconds{500};
+
+    sut_t sut{};
+
+    std::atomic<bool> done{false};
+    std::atomic<int64_t> torn_reads{0};
+    std::atomic<int64_t> regressions{0};
+    std::atomic<int64_t> reads{0};
+
+    /// reads until done, checking every value is whole and generations never go backward
+    auto read() -> void
+    {
+        auto local_reads = int64_t{0};
+        auto last_generation = int64_t{0};
+        while (!done.load(std::memory_order_relaxed))
+        {
+            auto const [first, is_whole] = sut.read([](value_t const& value) noexcept {
+                auto const first = value.generations.front();
+                auto const is_whole = std::ranges::all_of(
+                    value.generations, [first](int64_t generation) noexcept { return generation == first; });
+                return std::pair{first, is_whole};
+            });
+
+            if (!is_whole) torn_reads.fetch_add(1, std::memory_order_relaxed);
+            if (first < last_generation) regressions.fetch_add(1, std::memory_order_relaxed);
+            last_generation = first;
+            ++local_reads;
+        }
+        reads.fetch_add(local_reads, std::memory_order_relaxed);
+    }
+
+    /// publishes increasing generations until the deadline, alternating whole publishes with in-place staging
+    auto write() -> int64_t
+    {
+        auto const deadline = std::chrono::steady_clock::now() + duration;
+        auto generation = int64_t{0};
+        auto value = value_t{};
+        while (std::chrono::steady_clock::now() < deadline)
+        {
+            ++generation;
+            if (generation % 2)
+            {
+                value.fill(generation);
+                sut.publish(value);
+            }
+            else
+            {
+                sut.stage().fill(generation);
+                sut.commit();
+            }
+        }
+        done.store(true, std::memory_order_relaxed);
+        return generation;
+    }
+};
+
+TEST_F(double_buffer_stress_test_t, readers_never_see_torn_or_stale_values)
+{
+    auto readers = std::vector<std::thread>{};
+    for (auto reader = 0; reader < reader_count; ++reader) readers.emplace_back([this] { read(); });
+
+    auto const generation_count = write();
+    for (auto& reader : readers) reader.join();
+
+    EXPECT_EQ(0, torn_reads.load());
+    EXPECT_EQ(0, regressions.load());
+    EXPECT_LT(0, generation_count);
+    EXPECT_LT(0, reads.load());
+
+    // the last publish is visible after the writer finishes
+    EXPECT_EQ(generation_count, sut.read()->generations.back());
+}
+
+} // namespace
+} // namespace crv
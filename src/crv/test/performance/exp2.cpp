@@ -0,0 +1,141 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief compares prod_exp2_t against the exp2 implementations it replaces, and checks its latency budget
+///
+/// Throughput is measured over independent inputs, so calls overlap. Latency is measured by feeding each result back
+/// into the next input, so every call waits for the last; this is the number latency_budget_cycles bounds.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/exp2.hpp>
+#include <crv/math/fixed/prod_exp2.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace crv {
+namespace {
+
+using eval_in_t = fixed_t<int64_t, 32>;
+using kernel_in_t = prod_exp2_t::in_t;
+
+/// pre-generates randomized inputs to keep generation latency out of the benchmark loop
+template <typename value_t, typename distribution_t>
+auto generate_test_data(size_t sample_size, distribution_t distribution) -> std::vector<value_t>
+{
+    auto data = std::vector<value_t>{};
+    data.reserve(sample_size);
+
+    auto rng = std::mt19937_64(std::random_device{}());
+    for (size_t index = 0; index < sample_size; ++index) data.push_back(value_t::literal(distribution(rng)));
+
+    return data;
+}
+
+/// executes the microbenchmark on a generic callable
+template <typename value_t, typename invocable_t>
+auto run_benchmark(std::vector<value_t> const& test_data, invocable_t&& func) -> float_t
+{
+    // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+    for (auto const& value : test_data) { do_not_optimize(func(value)); }
+
+    auto aux = uint32_t{0};
+
+    // timed pass
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    for (auto const& value : test_data) do_not_optimize(func(value));
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    auto const total_cycles = end_cycles - start_cycles;
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+}
+
+/// measures the kernel's latency with a dependent chain; each input is xored with the previous output
+auto run_latency_benchmark(std::vector<kernel_in_t> const& test_data) -> float_t
+{
+    constexpr auto kernel = prod_exp2_t{};
+
+    auto chain = uint64_t{0};
+    for (auto const& value : test_data) chain = kernel(kernel_in_t::literal(value.value ^ chain)).value & 1;
+
+    auto aux = uint32_t{0};
+
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    for (auto const& value : test_data) chain = kernel(kernel_in_t::literal(value.value ^ chain)).value & 1;
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    do_not_optimize(chain);
+
+    auto const total_cycles = end_cycles - start_cycles;
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+}
+
+auto main() -> int
+{
+    constexpr auto const sample_size = 10'000'000u;
+
+    std::cout << "Generating " << sample_size << " random test cases...\n";
+
+    // [-16, 16), the range the curves use
+    auto const eval_data = generate_test_data<eval_in_t>(sample_size,
+        std::uniform_int_distribution<int64_t>{eval_in_t{-16}.value, eval_in_t{16}.value - 1});
+    auto const kernel_data
+        = generate_test_data<kernel_in_t>(sample_size, std::uniform_int_distribution<uint64_t>{0, max<uint64_t>()});
+
+    std::cout << "Data generated. Running benchmark...\n\n";
+
+    constexpr auto preprod = preprod_exp2_t{};
+    constexpr auto prod = prod_exp2_t{};
+    constexpr auto normalized = exp2_normalized_q64_to_q1_63_t{};
+
+    auto const preprod_cycles
+        = run_benchmark(eval_data, [&](eval_in_t input) { return preprod.eval<uint64_t, 32>(input); });
+    auto const prod_cycles = run_benchmark(eval_data, [&](eval_in_t input) { return prod.eval<uint64_t, 32>(input); });
+
+    auto const normalized_kernel_cycles
+        = run_benchmark(kernel_data, [&](kernel_in_t input) { return normalized(input); });
+    auto const prod_kernel_cycles = run_benchmark(kernel_data, [&](kernel_in_t input) { return prod(input); });
+
+    auto const latency_cycles = run_latency_benchmark(kernel_data);
+
+    std::cout << std::fixed << std::setprecision(5);
+    std::cout << "preprod_exp2_t::eval                : " << preprod_cycles << " cycles/iteration\n";
+    std::cout << "prod_exp2_t::eval                   : " << prod_cycles << " cycles/iteration\n";
+    std::cout << "exp2_normalized_q64_to_q1_63_t      : " << normalized_kernel_cycles << " cycles/iteration\n";
+    std::cout << "prod_exp2_t kernel                  : " << prod_kernel_cycles << " cycles/iteration\n";
+    std::cout << "prod_exp2_t kernel latency          : " << latency_cycles << " cycles (budget "
+              << prod_exp2_t::latency_budget_cycles << ")\n";
+
+    if (latency_cycles > prod_exp2_t::latency_budget_cycles)
+    {
+        std::cerr << "prod_exp2_t kernel is over its latency budget\n";
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+} // namespace
+} // namespace crv
+
+auto main() -> int
+{
+    return crv::main();
+}
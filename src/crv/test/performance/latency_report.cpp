@@ -0,0 +1,56 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief prints the kernel module's per-stage latency histograms as percentiles
+///
+/// The module exports its histograms through debugfs when built with ENABLE_LATENCY_HISTOGRAMS. Each stage's counts
+/// are summed across cpus and printed as a mean and percentiles in cycles.
+///
+/// usage: latency_report file
+///
+/// file is usually /sys/kernel/debug/<module>/latency, or a copy of it taken before and after a session.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/input/latency_report.hpp>
+#include <fstream>
+#include <iostream>
+#include <span>
+
+namespace crv::input {
+namespace {
+
+auto main(std::span<char* const> args) -> int
+{
+    if (args.size() != 2)
+    {
+        std::cerr << "usage: " << args[0] << " file\n";
+        return 2;
+    }
+
+    auto in = std::ifstream{args[1]};
+    if (!in)
+    {
+        std::cerr << args[1] << ": could not open\n";
+        return 1;
+    }
+
+    auto const stages = parse_latency(in);
+    if (!stages)
+    {
+        std::cerr << args[1] << ": malformed latency histograms\n";
+        return 1;
+    }
+
+    for (auto const& stage : *stages) std::cout << stage << "\n";
+    return 0;
+}
+
+} // namespace
+} // namespace crv::input
+
+auto main(int argc, char* argv[]) -> int
+{
+    return crv::input::main(std::span{argv, static_cast<std::size_t>(argc)});
+}
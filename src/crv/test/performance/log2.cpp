@@ -0,0 +1,133 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief times log2_t against libm's log2
+///
+/// Throughput is measured over independent inputs, so calls overlap. Latency is measured by feeding each result back
+/// into the next input, so every call waits for the last.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/log2.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <vector>
+
+namespace crv {
+namespace {
+
+using eval_in_t = fixed_t<uint64_t, 32>;
+using eval_out_t = fixed_t<int64_t, 32>;
+using kernel_in_t = log2_t::in_t;
+
+/// pre-generates randomized inputs to keep generation latency out of the benchmark loop
+template <typename value_t, typename distribution_t>
+auto generate_test_data(size_t sample_size, distribution_t distribution) -> std::vector<value_t>
+{
+    auto data = std::vector<value_t>{};
+    data.reserve(sample_size);
+
+    auto rng = std::mt19937_64(std::random_device{}());
+    for (size_t index = 0; index < sample_size; ++index) data.push_back(value_t::literal(distribution(rng)));
+
+    return data;
+}
+
+/// executes the microbenchmark on a generic callable
+template <typename value_t, typename invocable_t>
+auto run_benchmark(std::vector<value_t> const& test_data, invocable_t&& func) -> float_t
+{
+    // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+    for (auto const& value : test_data) { do_not_optimize(func(value)); }
+
+    auto aux = uint32_t{0};
+
+    // timed pass
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    for (auto const& value : test_data) do_not_optimize(func(value));
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    auto const total_cycles = end_cycles - start_cycles;
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+}
+
+/// measures the kernel's latency with a dependent chain; each input is xored with the previous output
+auto run_latency_benchmark(std::vector<kernel_in_t> const& test_data) -> float_t
+{
+    constexpr auto kernel = log2_t{};
+
+    auto chain = uint64_t{0};
+    for (auto const& value : test_data) chain = kernel(kernel_in_t::literal(value.value ^ chain)).value & 1;
+
+    auto aux = uint32_t{0};
+
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    for (auto const& value : test_data) chain = kernel(kernel_in_t::literal(value.value ^ chain)).value & 1;
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    do_not_optimize(chain);
+
+    auto const total_cycles = end_cycles - start_cycles;
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+}
+
+auto main() -> int
+{
+    constexpr auto const sample_size = 10'000'000u;
+
+    std::cout << "Generating " << sample_size << " random test cases...\n";
+
+    // (0, 2^16), speeds in counts per millisecond
+    auto const eval_data = generate_test_data<eval_in_t>(
+        sample_size, std::uniform_int_distribution<uint64_t>{1, eval_in_t{uint64_t{1} << 16}.value - 1});
+    auto const kernel_data
+        = generate_test_data<kernel_in_t>(sample_size, std::uniform_int_distribution<uint64_t>{0, max<uint64_t>()});
+
+    auto float_data = std::vector<double>{};
+    float_data.reserve(eval_data.size());
+    for (auto const& value : eval_data) float_data.push_back(static_cast<double>(value.value) / (1ull << 32));
+
+    std::cout << "Data generated. Running benchmark...\n\n";
+
+    constexpr auto log2 = log2_t{};
+
+    auto const eval_cycles = run_benchmark(
+        eval_data, [&](eval_in_t input) { return log2.eval<eval_out_t::value_t, eval_out_t::frac_bits>(input); });
+    auto const kernel_cycles = run_benchmark(kernel_data, [&](kernel_in_t input) { return log2(input); });
+    auto const latency_cycles = run_latency_benchmark(kernel_data);
+
+    // libm, for scale; the handler can't use it
+    auto const libm_cycles = run_benchmark(float_data, [](double input) { return std::log2(input); });
+
+    std::cout << std::fixed << std::setprecision(5);
+    std::cout << "log2_t::eval       : " << eval_cycles << " cycles/iteration\n";
+    std::cout << "log2_t kernel      : " << kernel_cycles << " cycles/iteration\n";
+    std::cout << "log2_t latency     : " << latency_cycles << " cycles\n";
+    std::cout << "std::log2 (double) : " << libm_cycles << " cycles/iteration\n";
+
+    return 0;
+}
+
+} // namespace
+} // namespace crv
+
+auto main() -> int
+{
+    return crv::main();
+}
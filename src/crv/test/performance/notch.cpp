@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief compares the notch's cost against the speed computation it shares an rsqrt with
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/input/notch.hpp>
+#include <crv/input/pipeline.hpp>
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <numbers>
+#include <random>
+#include <vector>
+
+namespace crv {
+namespace {
+
+using input::motion_t;
+using accelerator_t = input::prod_accelerator_t;
+
+/// pre-generates randomized inputs to keep generation latency out of the benchmark loop
+///
+/// Counts are what a mouse reports per poll, and half the motion is near an axis, so the notch takes both paths.
+auto generate_test_data(size_t sample_size) -> std::vector<motion_t>
+{
+    auto data = std::vector<motion_t>{};
+    data.reserve(sample_size);
+
+    auto rng = std::mt19937_64(std::random_device{}());
+    auto major_dist = std::uniform_int_distribution<int32_t>{-127, 127};
+    auto minor_dist = std::uniform_int_distribution<int32_t>{-8, 8};
+    auto axis_dist = std::bernoulli_distribution{0.5};
+
+    for (size_t index = 0; index < sample_size; ++index)
+    {
+        auto const major = major_dist(rng);
+        auto const minor = axis_dist(rng) ? minor_dist(rng) : major_dist(rng);
+        data.push_back(axis_dist(rng) ? motion_t{major, minor} : motion_t{minor, major});
+    }
+
+    return data;
+}
+
+/// executes the microbenchmark on a generic callable
+template <typename invocable_t>
+auto run_benchmark(std::vector<motion_t> const& test_data, invocable_t&& func) -> float_t
+{
+    // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+    for (auto const& motion : test_data) { do_not_optimize(func(motion)); }
+
+    auto aux = uint32_t{0};
+
+    // timed pass
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    for (auto const& motion : test_data) do_not_optimize(func(motion));
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    auto const total_cycles = end_cycles - start_cycles;
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+}
+
+auto main() -> int
+{
+    constexpr auto const sample_size = 10'000'000u;
+
+    std::cout << "Generating " << sample_size << " random test cases...\n";
+    auto const test_data = generate_test_data(sample_size);
+    std::cout << "Data generated. Running benchmark...\n\n";
+
+    constexpr auto accelerator = accelerator_t{};
+    constexpr auto rsqrt = accelerator_t::rsqrt_t{};
+
+    // half width, 22.5 degrees
+    auto notch = input::notch_t{};
+    notch.threshold(to_fixed<input::notch_t::threshold_t>(std::sin(std::numbers::pi_v<float_t> / 8)));
+
+    auto const speed_cycles = run_benchmark(test_data, [&](motion_t motion) { return accelerator.speed(motion); });
+
+    auto const shared_cycles = run_benchmark(test_data, [&](motion_t motion) {
+        auto const magnitude = accelerator.magnitude(motion);
+        auto const notched = notch(motion, magnitude.inverse_length);
+        do_not_optimize(notched);
+        return accelerator.speed(magnitude);
+    });
+
+    // what the notch would cost if it took its own rsqrt
+    auto const separate_cycles = run_benchmark(test_data, [&](motion_t motion) {
+        auto const x = int64_t{motion.x};
+        auto const y = int64_t{motion.y};
+        auto const length_squared = accelerator_t::length_squared_t::literal(static_cast<uint64_t>(x * x + y * y));
+        auto const notched = notch(motion, length_squared ? rsqrt(length_squared) : accelerator_t::inverse_length_t{});
+        do_not_optimize(notched);
+        return accelerator.speed(motion);
+    });
+
+    std::cout << std::fixed << std::setprecision(5);
+    std::cout << "Speed               : " << speed_cycles << " cycles/iteration\n";
+    std::cout << "Speed + notch       : " << shared_cycles << " cycles/iteration\n";
+    std::cout << "Speed + notch rsqrt : " << separate_cycles << " cycles/iteration\n";
+    std::cout << "Notch               : " << shared_cycles - speed_cycles << " cycles/iteration\n";
+
+    return 0;
+}
+
+} // namespace
+} // namespace crv
+
+auto main() -> int
+{
+    return crv::main();
+}
@@ -1,103 +1,405 @@
 // SPDX-License-Identifier: MIT
 
 /// \file
+/// \brief times the per-event pipeline, end to end and per stage
+///
+/// usage: performance_test_pipeline [--compare-batch]
+///
+/// Each event drives the pipeline through its c interface, as the input handler does: crv_source_move() for each axis
+/// that moved, then crv_source_report(). The source is attached and configured like a device with default settings,
+/// over a generated production spline. Events follow a few shapes of real motion rather than uniform noise, since
+/// interval reuse, idle resets, and segment locality all depend on what came before.
+///
+/// End-to-end throughput is measured without fences, so consecutive events overlap as they would in a tight loop.
+///
+/// Per-stage latencies come from the pipeline's latency probes. This benchmark links its own copy of the pipeline with
+/// them compiled in, so they are available without ENABLE_LATENCY_HISTOGRAMS. Moves and reports are probed the way the
+/// input handler probes them, and reports probe their own stages, so these are the same stages the module exports
+/// through debugfs: delta, transform, length via rsqrt, notch, velocity, spline lookup as locate and evaluate, scaled
+/// output, and remainder carry. Each stage prints its mean and tail cycles.
+///
+/// Probes are not fenced, and add their timer reads to what they measure and to the end-to-end number. The cost of one
+/// empty probe is measured and printed with the end-to-end number, along with how many each event pays for.
+///
+/// --compare-batch also runs the lengths' rsqrts through batch_rsqrt_t, 4 and 8 at a time, checks that every result is
+/// bit-identical to the scalar path, and reports each path's cycles per length.
+///
 /// \copyright Copyright (C) 2026 Frank Secilia
 
 #include <crv/lib.hpp>
+#include <crv/input/latency.hpp>
+#include <crv/input/latency_report.hpp>
+#include <crv/input/pipeline.hpp>
+#include <crv/math/fixed/batch_rsqrt.hpp>
 #include <crv/math/fixed/fixed.hpp>
-#include <crv/math/fixed/rsqrt.hpp>
-#include <crv/math/linear.hpp>
+#include <crv/spline/prod_spline.hpp>
 #include <crv/test/performance/performance.hpp>
+#include <crv/test/performance/prod_spline_generator.hpp>
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <iostream>
+#include <numbers>
 #include <random>
+#include <span>
+#include <string_view>
 #include <vector>
 
 namespace crv {
 namespace {
 
-struct pipeline_t
+using input::motion_t;
+using accelerator_t = input::prod_accelerator_t;
+
+// ====================================================================================================================
+// Pipeline
+// ====================================================================================================================
+
+/// one report from one device
+struct event_t
+{
+    int64_t time_us;
+    motion_t motion;
+};
+
+/// one source, attached and configured for as long as this lives, fed the way the input handler feeds it
+class source_t
 {
-    using mouse_dim_t = int16_t;
-    using mouse_vector_t = math::vector_t<mouse_dim_t, 2>;
-    using length_squared_t = fixed_t<uint32_t, 0>;
-    using length_t = fixed_t<uint64_t, 62>;
-    using curve_input_t = fixed_t<uint64_t, 56>;
-    using rsqrt_t = rsqrt_t<length_t, length_squared_t>;
+public:
+    source_t() noexcept : source_{crv_source_attach(this, "performance_test_pipeline")}
+    {
+        // what model::source_config() builds for a default device and profile
+        constexpr auto one = input::transform_t::coeff_t{1}.value;
+        constexpr auto config = crv_source_config{
+            .transform = {.xx = one, .xy = 0, .yx = 0, .yy = one},
+            .notch_threshold = 0,
+            .filter_halflife_us = 2'000,
+        };
+        crv_source_configure(source_, &config);
+    }
+
+    ~source_t() { crv_source_detach(source_); }
 
-    rsqrt_t rsqrt;
+    source_t(source_t const&) = delete;
+    auto operator=(source_t const&) -> source_t& = delete;
 
-    auto run(mouse_vector_t in) -> mouse_vector_t
+    /// moves by event's motion, one axis at a time, then ends the report
+    auto operator()(event_t const& event) noexcept -> crv_motion
     {
-        auto const length_squared = rsqrt_t::in_t::literal(in[0] * in[0] + in[1] * in[1]);
-        auto const rlength = rsqrt(length_squared);
-        auto const length = length_t::convert(length_squared * rlength);
+        CRV_LATENCY_DECLARE(start_cycles);
+
+        if (event.motion.x) move(event.motion.x, 0);
+        if (event.motion.y) move(0, event.motion.y);
+
+        auto output = crv_motion{};
+        CRV_LATENCY_START(start_cycles);
+        crv_source_report(source_, event.time_us, &output);
+        CRV_LATENCY_STOP(CRV_LATENCY_REPORT, start_cycles);
+
+        return output;
+    }
 
-        do_not_optimize(length);
+private:
+    auto move(int x, int y) noexcept -> void
+    {
+        CRV_LATENCY_DECLARE(start_cycles);
 
-        return in;
+        CRV_LATENCY_START(start_cycles);
+        crv_source_move(source_, x, y);
+        CRV_LATENCY_STOP(CRV_LATENCY_FILTER, start_cycles);
     }
+
+    crv_source* source_;
 };
 
-struct test_case_t
+// ====================================================================================================================
+// Input Distributions
+//
+// Velocities are in counts per ms. Devices only report motion, so events that round to no motion are dropped, and the
+// next event's interval covers the gap.
+// ====================================================================================================================
+
+/// appends an event moving at velocity over interval_us, if it moves at all
+auto push_event(std::vector<event_t>& events, int64_t time_us, int64_t interval_us, float_t vx, float_t vy) -> void
 {
-    pipeline_t::mouse_vector_t in;
-};
+    auto const ms = static_cast<float_t>(interval_us) / 1000.0;
+    auto const motion
+        = motion_t{static_cast<int32_t>(std::lround(vx * ms)), static_cast<int32_t>(std::lround(vy * ms))};
+    if (motion != motion_t{}) events.push_back({time_us, motion});
+}
 
-/// pre-generates randomized inputs to keep generation latency out of the benchmark loop
-auto generate_test_data(size_t sample_size) -> std::vector<test_case_t>
+/// steady motion at 1 kHz whose velocity wanders; consecutive events usually share segments and intervals
+auto generate_random_walk(size_t sample_size, std::mt19937_64& rng) -> std::vector<event_t>
 {
-    auto data = std::vector<test_case_t>{};
-    data.reserve(sample_size);
+    auto events = std::vector<event_t>{};
+    events.reserve(sample_size);
 
-    auto rng = std::mt19937_64(std::random_device{}());
+    constexpr auto max_speed = 100.0;
+    auto step_dist = std::normal_distribution<float_t>{0.0, 0.5};
+    auto jitter_dist = std::uniform_int_distribution<int64_t>{-8, 8};
+
+    auto time_us = int64_t{0};
+    auto vx = float_t{0.0};
+    auto vy = float_t{0.0};
+    while (events.size() < sample_size)
+    {
+        auto const interval_us = 1000 + jitter_dist(rng);
+        time_us += interval_us;
+        vx = std::clamp(vx + step_dist(rng), -max_speed, max_speed);
+        vy = std::clamp(vy + step_dist(rng), -max_speed, max_speed);
+        push_event(events, time_us, interval_us, vx, vy);
+    }
+
+    return events;
+}
+
+/// fast 8 kHz bursts in random directions, separated by pauses short enough to stay one motion
+auto generate_bursts(size_t sample_size, std::mt19937_64& rng) -> std::vector<event_t>
+{
+    auto events = std::vector<event_t>{};
+    events.reserve(sample_size);
+
+    constexpr auto interval_us = int64_t{125};
+    auto length_dist = std::uniform_int_distribution<int_t>{20, 200};
+    auto pause_dist = std::uniform_int_distribution<int64_t>{2'000, 50'000};
+    auto speed_dist = std::uniform_real_distribution<float_t>{20.0, 120.0};
+    auto angle_dist = std::uniform_real_distribution<float_t>{0.0, 2.0 * std::numbers::pi_v<float_t>};
+    auto noise_dist = std::normal_distribution<float_t>{1.0, 0.1};
 
-    auto dim_dist = std::uniform_int_distribution<pipeline_t::mouse_dim_t>{0, max<pipeline_t::mouse_dim_t>()};
+    auto time_us = int64_t{0};
+    while (events.size() < sample_size)
+    {
+        time_us += pause_dist(rng);
 
-    for (size_t index = 0; index < sample_size; ++index) { data.push_back({dim_dist(rng), dim_dist(rng)}); }
+        auto const speed = speed_dist(rng);
+        auto const angle = angle_dist(rng);
+        for (auto index = length_dist(rng); index > 0 && events.size() < sample_size; --index)
+        {
+            time_us += interval_us;
+            auto const noisy_speed = speed * noise_dist(rng);
+            push_event(events, time_us, interval_us, noisy_speed * std::cos(angle), noisy_speed * std::sin(angle));
+        }
+    }
 
-    return data;
+    return events;
 }
 
-/// executes the microbenchmark on a generic callable
-template <typename invocable_t>
-auto run_benchmark(std::vector<test_case_t> const& test_data, invocable_t&& func) -> float_t
+/// long idles, each ended by a 1 kHz flick that accelerates to a peak and back; every flick starts a new motion
+auto generate_idle_to_flick(size_t sample_size, std::mt19937_64& rng) -> std::vector<event_t>
 {
-    // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
-    for (auto const& test_case : test_data) { do_not_optimize(func(test_case)); }
+    auto events = std::vector<event_t>{};
+    events.reserve(sample_size);
+
+    constexpr auto interval_us = int64_t{1000};
+    auto idle_dist = std::uniform_int_distribution<int64_t>{150'000, 500'000};
+    auto length_dist = std::uniform_int_distribution<int_t>{40, 120};
+    auto peak_dist = std::uniform_real_distribution<float_t>{50.0, 250.0};
+    auto angle_dist = std::uniform_real_distribution<float_t>{0.0, 2.0 * std::numbers::pi_v<float_t>};
+
+    auto time_us = int64_t{0};
+    while (events.size() < sample_size)
+    {
+        time_us += idle_dist(rng);
+
+        auto const length = length_dist(rng);
+        auto const peak = peak_dist(rng);
+        auto const angle = angle_dist(rng);
+        for (auto index = 0; index < length && events.size() < sample_size; ++index)
+        {
+            time_us += interval_us;
+            auto const speed = peak * std::sin(std::numbers::pi_v<float_t> * (index + 1) / (length + 1));
+            push_event(events, time_us, interval_us, speed * std::cos(angle), speed * std::sin(angle));
+        }
+    }
+
+    return events;
+}
 
+// ====================================================================================================================
+// Benchmarks
+// ====================================================================================================================
+
+/// times func over every value, in order, in one pass
+template <typename value_t, typename func_t>
+auto run_benchmark(std::vector<value_t> const& values, func_t&& func) -> float_t
+{
     auto aux = uint32_t{0};
 
-    // timed pass
     _mm_lfence();
     auto const start_cycles = __rdtsc();
     _mm_lfence();
 
-    for (auto const& test_case : test_data) do_not_optimize(func(test_case));
+    for (auto const& value : values) do_not_optimize(func(value));
 
     _mm_lfence();
     auto const end_cycles = __rdtscp(&aux);
     _mm_lfence();
 
     auto const total_cycles = end_cycles - start_cycles;
-    return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(values.size());
 }
 
-auto main() -> int
+/// \returns counts the probes recorded since before was copied
+auto latency_since(crv_latency const& before) -> crv_latency
 {
-    constexpr auto const sample_size = 10'000'000u;
+    auto result = *crv_latency_local();
+    for (auto stage = 0; stage < CRV_LATENCY_STAGE_COUNT; ++stage)
+    {
+        for (auto bucket = 0; bucket < CRV_LATENCY_BUCKET_COUNT; ++bucket)
+        {
+            result.counts[stage][bucket] -= before.counts[stage][bucket];
+        }
+        result.cycles[stage] -= before.cycles[stage];
+    }
+    return result;
+}
 
-    std::cout << "Generating " << sample_size << " random test cases...\n";
-    auto const test_data = generate_test_data(sample_size);
-    std::cout << "Data generated. Running benchmark...\n\n";
+/// times a probe around nothing, once per event
+///
+/// User mode never emits, so the emit stage is free to count these; the reports only count what follows.
+auto time_probe(std::vector<event_t> const& events) -> float_t
+{
+    auto const probe = [](event_t const&) { return input::probe(CRV_LATENCY_EMIT, [] { return 0; }); };
+
+    // warmup pass
+    for (auto const& event : events) do_not_optimize(probe(event));
+
+    return run_benchmark(events, probe);
+}
+
+auto report(std::string_view distribution, std::vector<event_t> const& events) -> void
+{
+    auto const probe_cycles = time_probe(events);
 
-    auto pipeline = pipeline_t{};
+    // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+    {
+        auto warmup = source_t{};
+        for (auto const& event : events) do_not_optimize(warmup(event));
+    }
+
+    // timed pass, through a fresh source, so it starts as the warmup did
+    auto const latency_before = *crv_latency_local();
+    auto timed = source_t{};
+    auto const cycles = run_benchmark(events, timed);
+    auto const stages = input::latency_stages(latency_since(latency_before));
+
+    auto probe_count = int_t{0};
+    for (auto const& stage : stages) probe_count += stage.histogram.count();
+    auto const probes_per_event = static_cast<float_t>(probe_count) / static_cast<float_t>(events.size());
+
+    std::cout << distribution << ":\n";
+    std::cout << "    end to end: " << cycles << " cycles/event, including " << probes_per_event << " probes/event at "
+              << probe_cycles << " cycles/probe\n";
+    for (auto const& stage : stages)
+    {
+        if (stage.histogram.count()) std::cout << "    " << stage << "\n";
+    }
+}
+
+// ====================================================================================================================
+// Batch Comparison
+// ====================================================================================================================
+
+using rsqrt_t = accelerator_t::rsqrt_t;
+
+/// times rsqrt of every input, in batches of lane_count, and checks each result against expected
+template <int_t lane_count>
+auto compare_batch(std::vector<rsqrt_t::in_t> const& inputs, std::vector<rsqrt_t::out_t> const& expected) -> bool
+{
+    using batch_t = batch_rsqrt_t<rsqrt_t, lane_count>;
+    constexpr auto batch = batch_t{};
+
+    auto outputs = std::vector<typename batch_t::out_t>(inputs.size());
+    auto const run = [&] { batch(std::span{inputs}, std::span{outputs}); };
+
+    // warmup pass
+    run();
+
+    auto aux = uint32_t{0};
+
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    run();
+    clobber_memory();
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    auto mismatches = 0;
+    for (auto index = 0u; index < inputs.size(); ++index) mismatches += outputs[index] != expected[index];
+
+    auto const cycles = static_cast<float_t>(end_cycles - start_cycles) / static_cast<float_t>(inputs.size());
+    std::cout << "Batch rsqrt x" << lane_count << " : " << cycles << " cycles/length, " << mismatches
+              << " mismatches\n";
+    return mismatches == 0;
+}
+
+/// times scalar rsqrt against batch_rsqrt_t over the same lengths
+auto compare_batch(std::vector<event_t> const& events) -> bool
+{
+    constexpr auto accelerator = accelerator_t{};
+    constexpr auto rsqrt = rsqrt_t{};
+
+    // generated events always move, so every length is nonzero
+    auto inputs = std::vector<rsqrt_t::in_t>{};
+    inputs.reserve(events.size());
+    for (auto const& event : events) inputs.push_back(accelerator.magnitude(event.motion).length_squared);
+
+    auto expected = std::vector<rsqrt_t::out_t>{};
+    expected.reserve(inputs.size());
+    for (auto const input : inputs) expected.push_back(rsqrt(input));
+
+    // warmup pass
+    for (auto const input : inputs) do_not_optimize(rsqrt(input));
+
+    auto const cycles = run_benchmark(inputs, rsqrt);
+    std::cout << "Scalar rsqrt   : " << cycles << " cycles/length\n";
+
+    auto const batch4 = compare_batch<4>(inputs, expected);
+    auto const batch8 = compare_batch<8>(inputs, expected);
+    return batch4 && batch8;
+}
+
+auto main(std::span<char* const> args) -> int
+{
+    auto compare = false;
+    for (auto const arg : args.subspan(1))
+    {
+        if (std::string_view{arg} == "--compare-batch") compare = true;
+        else
+        {
+            std::cerr << "usage: " << args[0] << " [--compare-batch]\n";
+            return 2;
+        }
+    }
+
+    constexpr auto const sample_size = 2'000'000u;
 
-    auto const cycles
-        = run_benchmark(test_data, [&](test_case_t const& test_case) { return pipeline.run(test_case.in); });
+    std::cout << "Generating spline...\n";
+    auto const spline = spline::generate_prod_spline();
+    std::cout << "Spline has " << spline.payload.segment_locator.segment_count() << " segments.\n";
+    input::active_spline().publish(spline);
 
-    std::cout << std::fixed << std::setprecision(5);
-    std::cout << "Pipeline : " << cycles << " cycles/iteration\n";
+    std::cout << "Generating " << sample_size << " events per distribution...\n";
+    auto rng = std::mt19937_64(std::random_device{}());
+    auto const random_walk = generate_random_walk(sample_size, rng);
+    auto const bursts = generate_bursts(sample_size, rng);
+    auto const idle_to_flick = generate_idle_to_flick(sample_size, rng);
+    std::cout << "Data generated. Running benchmark...\n\n";
+
+    std::cout << std::fixed << std::setprecision(2);
+    report("Random walk", random_walk);
+    report("Bursts", bursts);
+    report("Idle to flick", idle_to_flick);
+
+    if (compare)
+    {
+        std::cout << "\n";
+        if (!compare_batch(random_walk)) return 1;
+    }
 
     return 0;
 }
@@ -105,7 +407,7 @@ auto main() -> int
 } // namespace
 } // namespace crv
 
-auto main() -> int
+auto main(int argc, char* argv[]) -> int
 {
-    return crv::main();
+    return crv::main(std::span{argv, static_cast<std::size_t>(argc)});
 }
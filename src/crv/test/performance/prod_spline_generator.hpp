@@ -0,0 +1,150 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief generates a representative production spline for performance executables
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/priority_queue.hpp>
+#include <crv/spline/construction/segment/amr/approximant.hpp>
+#include <crv/spline/construction/segment/amr/bisection.hpp>
+#include <crv/spline/construction/segment/amr/error_metric.hpp>
+#include <crv/spline/construction/segment/amr/function_sampler.hpp>
+#include <crv/spline/construction/segment/amr/interval.hpp>
+#include <crv/spline/construction/segment/amr/node_generator.hpp>
+#include <crv/spline/construction/segment/amr/residual_estimator.hpp>
+#include <crv/spline/construction/segment/amr/subdivision.hpp>
+#include <crv/spline/construction/segment/amr/subdivision_predicate.hpp>
+#include <crv/spline/construction/segment/field_packer.hpp>
+#include <crv/spline/construction/segment/segment_factory.hpp>
+#include <crv/spline/construction/segment/segment_packer.hpp>
+#include <crv/spline/construction/segment/segment_quantizer.hpp>
+#include <crv/spline/construction/segment/shift_planner.hpp>
+#include <crv/spline/construction/spline/amr/assembler.hpp>
+#include <crv/spline/construction/spline/amr/refinement_pool_seeder.hpp>
+#include <crv/spline/construction/spline/amr/refiner.hpp>
+#include <crv/spline/construction/spline/amr/seed/critical_point_conditioner.hpp>
+#include <crv/spline/construction/spline/amr/seed/dyadic_stride_calculator.hpp>
+#include <crv/spline/construction/spline/amr/seed/span_decomposer.hpp>
+#include <crv/spline/construction/spline/amr/seed/subdomain_factory.hpp>
+#include <crv/spline/construction/spline/amr/spline_generator.hpp>
+#include <crv/spline/construction/spline/amr/typestates.hpp>
+#include <crv/spline/construction/spline/amr/workspace.hpp>
+#include <crv/spline/construction/spline/tangent_extender.hpp>
+#include <crv/spline/construction/weight_functions/hyperbolic_decay.hpp>
+#include <crv/spline/prod_spline.hpp>
+#include <cmath>
+#include <vector>
+
+namespace crv::spline {
+
+/// generates a prod spline approximating a log1p-shaped curve with a few critical points
+///
+/// This mirrors spline_integration_test. The result is representative of a real curve's segment count and density.
+template <typename spline_t = prod_spline_t> auto generate_prod_spline() -> spline_t
+{
+    using scalar_t = float_t;
+
+    using traits_t = prod_traits_t;
+    using mantissa_t = traits_t::mantissa_t;
+    using unpacked_field_t = traits_t::unpacked_field_t;
+    using packed_field_t = traits_t::packed_field_t;
+    using unpacked_segment_t = traits_t::unpacked_segment_t;
+    using packed_segment_t = traits_t::packed_segment_t;
+
+    using x_t = prod_pipeline_config_t::x_t;
+    using y_t = prod_pipeline_config_t::y_t;
+
+    constexpr auto max_segment_count = spline_t::max_segment_count;
+    constexpr auto domain_end = 1 << prod_log2_domain_end;
+    constexpr auto log2_min_width = prod_log2_min_width;
+    constexpr auto global_tolerance = 1e-10;
+    constexpr auto y_limit = 1000.0;
+
+    constexpr auto segment_layout = prod_pipeline_config.segment_layout;
+
+    using segment_t = spline_t::segment_t;
+    using cubic_t = cubic_t<scalar_t>;
+    using weight_function_t = weight_functions::hyperbolic_decay_t<scalar_t>;
+    using subdomain_t = subdomain_t<scalar_t>;
+    using interval_t = interval_t<subdomain_t, cubic_t, segment_t>;
+    using refinement_pool_t = priority_queue_t<std::vector<interval_t>, interval_priority_less_t>;
+    using node_generator_t = node_generator_t<scalar_t, 8>;
+    using residual_estimator_t = residual_estimator_t<scalar_t, node_generator_t, error_metric_t, weight_function_t>;
+    using hermite_converter_t = hermite_converter_t<scalar_t>;
+    using approximant_t = approximant_t<scalar_t, segment_t>;
+    using approximant_factory_t = approximant_factory_t<approximant_t>;
+    using float_extractor_t = float_extractor_t<scalar_t>;
+    using exponent_aligner_t
+        = exponent_aligner_t<segment_layout.final.min_shift(), segment_layout.final.max_shift()>;
+    using scaled_int_t = float_extractor_t::scaled_int_t;
+    using radix_aligner_t = radix_aligner_t<unpacked_field_t, scaled_int_t, exponent_aligner_t{}>;
+    using field_packer_t = field_packer_t<packed_field_t>;
+    using mantissa_quantizer_t = mantissa_quantizer_t<mantissa_t>;
+    using shift_planner_t = shift_planner_t<mantissa_t>;
+    using segment_quantizer_t = segment_quantizer_t<unpacked_field_t, float_extractor_t, shift_planner_t,
+        mantissa_quantizer_t, radix_aligner_t, segment_layout.intermediate.max_shift(), x_t::frac_bits,
+        y_t::frac_bits, log2_min_width>;
+    using segment_packer_t = segment_packer_t<packed_segment_t, unpacked_segment_t, field_packer_t, segment_layout>;
+    using segment_factory_t = segment_factory_t<segment_t, segment_quantizer_t, segment_packer_t>;
+    using interval_factory_t = interval_factory_t<interval_t, segment_factory_t, approximant_factory_t,
+        hermite_converter_t, residual_estimator_t>;
+    using bisector_t = bisector_t<bisection_t<subdomain_t>>;
+    using subdivision_predicate_t = subdivision_predicate_t<scalar_t, log2_min_width>;
+    using subdivider_t = subdivider_t<subdivision_t<interval_t>, bisector_t, interval_factory_t>;
+    using workspace_t = workspace_t<interval_t, interval_priority_less_t, max_segment_count>;
+    using typestates_t = typestates_t<workspace_t>;
+    using tangent_extender_t = tangent_extender_t<interval_t, typename spline_t::extended_tangent_t, float_extractor_t>;
+    using assembler_t = assembler_t<typename typestates_t::unassembled_t, interval_t, interval_sorter_t,
+        interval_unzipper_t, key_padder_t, tangent_extender_t, domain_end>;
+    using refiner_t
+        = refiner_t<typename typestates_t::unrefined_t, subdivider_t, subdivision_predicate_t, max_segment_count>;
+    using span_decomposer_t = seed::span_decomposer_t<seed::dyadic_stride_calculator_t<x_t>,
+        seed::subdomain_factory_t<x_t, subdomain_t>, interval_factory_t, max_segment_count, log2_min_width>;
+    using refinement_pool_seeder_t
+        = refinement_pool_seeder_t<typename typestates_t::unseeded_t, span_decomposer_t, prod_log2_domain_end>;
+    using critical_point_conditioner_t = seed::critical_point_conditioner_t<x_t, log2_min_width>;
+    using spline_generator_t = spline_generator_t<scalar_t, x_t, spline_t, typestates_t, critical_point_conditioner_t,
+        refinement_pool_t, refinement_pool_seeder_t, refiner_t, assembler_t>;
+
+    auto const create_interval = interval_factory_t{
+        .segment_factory = {},
+        .approximant_factory = {},
+        .convert_hermite = {},
+        .estimate_residual = residual_estimator_t{
+            .generate_nodes = {},
+            .measure_error = {},
+            .apply_weight = weight_function_t{.halflife = 0.5},
+        },
+    };
+
+    auto generate_spline = spline_generator_t{
+        refinement_pool_seeder_t{
+            .decompose_span{.calculate_stride = {}, .create_subdomain = {}, .create_interval = create_interval},
+        },
+        refiner_t{
+            .requires_subdivision = subdivision_predicate_t{.global_tolerance = global_tolerance},
+            .subdivide = subdivider_t{.bisect = bisector_t{}, .create_interval = create_interval},
+        },
+        assembler_t{
+            .sort_intervals = {},
+            .unzip_intervals = {},
+            .pad_keys = {},
+            .extend_tangent = tangent_extender_t{.y_limit = y_limit, .extract_float = {}},
+        },
+    };
+
+    auto const target_function = [](auto x) static noexcept -> decltype(x) {
+        using std::log1p;
+        return 2.1 * log1p(x);
+    };
+
+    auto spline = spline_t{};
+    generate_spline(spline, function_sampler_t{target_function}, {x_t{1 << 3}, x_t{1 << 5}, to_fixed<x_t>(248.973)});
+    return spline;
+}
+
+} // namespace crv::spline
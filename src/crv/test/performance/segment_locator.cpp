@@ -0,0 +1,136 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/spline/node_search.hpp>
+#include <crv/spline/segment_locator.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace crv {
+namespace {
+
+using x_t = int64_t;
+
+constexpr auto key_stride = x_t{1} << 20;
+
+/// builds a locator with evenly spaced keys
+template <typename segment_locator_t> auto create_locator() -> segment_locator_t
+{
+    auto keys = std::array<x_t, segment_locator_t::total_key_count>{};
+    for (auto index = 0u; index < keys.size(); ++index) keys[index] = static_cast<x_t>(index + 1) * key_stride;
+
+    return segment_locator_t{keys, static_cast<x_t>(keys.size() + 1) * key_stride,
+        segment_locator_t::max_segment_count};
+}
+
+/// pre-generates randomized inputs to keep generation latency out of the benchmark loop
+auto generate_test_data(size_t sample_size, x_t x_max) -> std::vector<x_t>
+{
+    auto data = std::vector<x_t>{};
+    data.reserve(sample_size);
+
+    auto rng = std::mt19937_64(std::random_device{}());
+    auto x_dist = std::uniform_int_distribution<x_t>{0, x_max - 1};
+
+    for (size_t index = 0; index < sample_size; ++index) data.push_back(x_dist(rng));
+
+    return data;
+}
+
+struct cycles_t
+{
+    float_t throughput; // independent locates
+    float_t latency; // each locate depends on the previous
+};
+
+/// executes the microbenchmark for one locator
+template <typename segment_locator_t>
+auto run_benchmark(segment_locator_t const& locator, std::vector<x_t> const& test_data) -> cycles_t
+{
+    auto const time = [&](auto&& func) {
+        // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+        for (auto const x : test_data) do_not_optimize(func(x));
+
+        auto aux = uint32_t{0};
+
+        // timed pass
+        _mm_lfence();
+        auto const start_cycles = __rdtsc();
+        _mm_lfence();
+
+        for (auto const x : test_data) do_not_optimize(func(x));
+
+        _mm_lfence();
+        auto const end_cycles = __rdtscp(&aux);
+        _mm_lfence();
+
+        auto const total_cycles = end_cycles - start_cycles;
+        return static_cast<float_t>(total_cycles) / static_cast<float_t>(test_data.size());
+    };
+
+    auto const throughput = time([&](x_t x) { return locator.locate(x).index; });
+
+    // feed each result into the next input; the dependency is always zero, but the compiler can't know that
+    auto carried = int_t{0};
+    auto const latency = time([&](x_t x) {
+        carried = locator.locate(x + (carried & (int_t{1} << 62))).index;
+        return carried;
+    });
+
+    return {.throughput = throughput, .latency = latency};
+}
+
+auto report(std::string_view name, cycles_t cycles) -> void
+{
+    std::cout << "    " << std::setw(7) << std::left << name << ": " << std::right << cycles.throughput
+              << " cycles/locate (throughput), " << cycles.latency << " cycles/locate (latency)\n";
+}
+
+template <int depth_max> auto run_depth(size_t sample_size) -> void
+{
+    using scalar_locator_t = spline::segment_locator_t<x_t, depth_max, spline::node_searches::scalar_t>;
+
+    auto const scalar_locator = create_locator<scalar_locator_t>();
+    auto const test_data = generate_test_data(sample_size, scalar_locator.x_max());
+
+    std::cout << "depth_max " << depth_max << " (" << scalar_locator_t::max_segment_count << " segments):\n";
+    report("scalar", run_benchmark(scalar_locator, test_data));
+
+#if defined __SSE4_2__
+    using sse42_locator_t = spline::segment_locator_t<x_t, depth_max, spline::node_searches::sse42_t>;
+    report("sse4.2", run_benchmark(create_locator<sse42_locator_t>(), test_data));
+#endif
+
+#if defined __AVX2__
+    using avx2_locator_t = spline::segment_locator_t<x_t, depth_max, spline::node_searches::avx2_t>;
+    report("avx2", run_benchmark(create_locator<avx2_locator_t>(), test_data));
+#endif
+}
+
+auto main() -> int
+{
+    constexpr auto const sample_size = 10'000'000u;
+
+    std::cout << std::fixed << std::setprecision(5);
+    run_depth<2>(sample_size);
+    run_depth<3>(sample_size);
+    run_depth<4>(sample_size);
+    run_depth<5>(sample_size);
+
+    return 0;
+}
+
+} // namespace
+} // namespace crv
+
+auto main() -> int
+{
+    return crv::main();
+}
@@ -0,0 +1,135 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief compares packed and pre-unpacked segment storage, hot and cold
+///
+/// Packed segments are unpacked on every evaluation, but fit in half a cache line. SoA segments skip unpacking, but
+/// spread each segment over 8 arrays. Hot, the unpack is the only difference. Cold, each evaluation also pays for the
+/// lines it touches, so this measures both and lets the numbers decide.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/math/stats.hpp>
+#include <crv/spline/prod_spline.hpp>
+#include <crv/spline/segment_storage.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <crv/test/performance/prod_spline_generator.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string_view>
+#include <vector>
+
+namespace crv {
+namespace {
+
+using packed_spline_t = spline::prod_spline_t;
+using soa_spline_t = spline::spline_t<spline::prod_segment_t, spline::prod_extended_tangent_t,
+    spline::prod_segment_locator_t, spline::locate_hints::none_t, spline::segment_storages::soa_t>;
+using x_t = packed_spline_t::x_t;
+
+constexpr auto domain_end = float_t{1 << spline::prod_log2_domain_end};
+constexpr auto cache_line_size = std::size_t{64};
+
+/// velocities drawn uniformly over the domain, so every segment is exercised
+auto generate_uniform(size_t sample_size, std::mt19937_64& rng) -> std::vector<x_t>
+{
+    auto data = std::vector<x_t>{};
+    data.reserve(sample_size);
+
+    auto velocity_dist = std::uniform_real_distribution<float_t>{0.0, domain_end};
+    for (size_t index = 0; index < sample_size; ++index) data.push_back(to_fixed<x_t>(velocity_dist(rng)));
+
+    return data;
+}
+
+/// evicts every line of an object from all cache levels
+auto flush(void const* object, std::size_t size) noexcept -> void
+{
+    auto const* const bytes = static_cast<std::byte const*>(object);
+    for (auto offset = std::size_t{0}; offset < size; offset += cache_line_size) _mm_clflush(bytes + offset);
+    _mm_mfence();
+}
+
+/// samples the latency of each evaluation separately, optionally flushing the whole spline before each one
+///
+/// Flushing the whole spline also evicts the locator, which both storages share, so cold latencies differ only by the
+/// segment lines each storage touches.
+template <typename spline_t> auto measure_latency(spline_t const& spline, std::vector<x_t> const& xs, bool cold)
+    -> distribution_t<int_t>
+{
+    auto result = distribution_t<int_t>{};
+    auto aux = uint32_t{0};
+
+    for (auto const x : xs)
+    {
+        if (cold) flush(&spline, sizeof(spline));
+
+        _mm_lfence();
+        auto const start_cycles = __rdtsc();
+        _mm_lfence();
+
+        do_not_optimize(spline(x));
+
+        auto const end_cycles = __rdtscp(&aux);
+        _mm_lfence();
+
+        result.sample(static_cast<int_t>(end_cycles - start_cycles));
+    }
+
+    return result;
+}
+
+auto report(std::string_view temperature, packed_spline_t const& packed_spline, soa_spline_t const& soa_spline,
+    std::vector<x_t> const& xs, bool cold) -> void
+{
+    std::cout << temperature << " latency (cycles):\n";
+    std::cout << "    packed: " << measure_latency(packed_spline, xs, cold) << "\n";
+    std::cout << "    soa   : " << measure_latency(soa_spline, xs, cold) << "\n";
+}
+
+auto main() -> int
+{
+    constexpr auto const hot_sample_size = 10'000'000u;
+    constexpr auto const cold_sample_size = 100'000u;
+
+    std::cout << "Generating splines...\n";
+    auto const packed_spline = spline::generate_prod_spline<packed_spline_t>();
+    auto const soa_spline = spline::generate_prod_spline<soa_spline_t>();
+    std::cout << "Segments are " << sizeof(packed_spline.payload.segments) << " bytes packed, "
+              << sizeof(soa_spline.payload.segments) << " bytes soa.\n";
+
+    std::cout << "Generating test cases...\n";
+    auto rng = std::mt19937_64(std::random_device{}());
+    auto const hot = generate_uniform(hot_sample_size, rng);
+    auto const cold = generate_uniform(cold_sample_size, rng);
+
+    // both storages must produce identical outputs, or the comparison is meaningless
+    for (auto const x : cold)
+    {
+        if (packed_spline(x) != soa_spline(x))
+        {
+            std::cout << "ERROR: soa output differs from packed output\n";
+            return 1;
+        }
+    }
+    std::cout << "Data generated. Running benchmark...\n\n";
+
+    std::cout << std::fixed << std::setprecision(5);
+    report("Hot", packed_spline, soa_spline, hot, false);
+    report("Cold", packed_spline, soa_spline, cold, true);
+
+    return 0;
+}
+
+} // namespace
+} // namespace crv
+
+auto main() -> int
+{
+    return crv::main();
+}
@@ -5,6 +5,7 @@
 
 #include <crv/lib.hpp>
 #include <crv/math/division/divider.hpp>
+#include <crv/math/division/reciprocal_divider.hpp>
 #include <crv/math/limits.hpp>
 #include <crv/math/rounding_mode.hpp>
 #include <crv/test/performance/performance.hpp>
@@ -57,6 +58,25 @@ auto generate_test_data(size_t sample_size) -> std::vector<test_case_t>
     return data;
 }
 
+/// pre-generates randomized dividends over a single divisor, as when dividing repeatedly by a configured constant
+auto generate_invariant_test_data(size_t sample_size) -> std::vector<test_case_t>
+{
+    auto data = std::vector<test_case_t>{};
+    data.reserve(sample_size);
+
+    auto rng = std::mt19937_64(std::random_device{}());
+    auto dist_word = std::uniform_int_distribution<narrow_t>{0, max<narrow_t>()};
+    auto const divisor = std::uniform_int_distribution<narrow_t>{1, max<narrow_t>()}(rng);
+
+    for (size_t index = 0; index < sample_size; ++index)
+    {
+        auto const dividend = (static_cast<wide_t>(dist_word(rng)) << narrow_width) | dist_word(rng);
+        data.push_back({dividend, divisor});
+    }
+
+    return data;
+}
+
 /// executes the microbenchmark on a generic callable
 template <typename invocable_t>
 auto run_benchmark(std::vector<test_case_t> const& test_data, invocable_t&& division_func) -> float_t
@@ -99,9 +119,46 @@ auto main() -> int
         return divider(dividend, divisor, rounding_modes::div::truncate);
     });
 
+    // invariant divisor; reciprocal_divider_t is built once, outside the timed loop, as it would be at configuration
+    auto const invariant_data = generate_invariant_test_data(sample_size);
+    auto const invariant_compiler_cycles
+        = run_benchmark(invariant_data, [](wide_t dividend, narrow_t divisor) { return dividend / divisor; });
+    auto const invariant_hardware_cycles = run_benchmark(invariant_data, [&divider](wide_t dividend, narrow_t divisor) {
+        return divider(dividend, divisor, rounding_modes::div::truncate);
+    });
+
+    using reciprocal_divider_t = division::reciprocal_divider_t<narrow_t>;
+    reciprocal_divider_t const reciprocal_divider{division::reciprocal_t<narrow_t>{invariant_data.front().divisor}};
+    auto const reciprocal_cycles
+        = run_benchmark(invariant_data, [&reciprocal_divider](wide_t dividend, narrow_t divisor) {
+              return reciprocal_divider(dividend, divisor, rounding_modes::div::truncate);
+          });
+
+    // composed into shifted_int_divider_t, as the pipeline uses it
+    using hardware_shifted_t = division::shifted_int_divider_t<
+        division::wide_divider_t<narrow_t, division::hardware_divider_t<narrow_t>>, 32, uint64_t, uint64_t, uint64_t>;
+    using reciprocal_shifted_t
+        = division::shifted_int_divider_t<reciprocal_divider_t, 32, uint64_t, uint64_t, uint64_t>;
+    hardware_shifted_t const hardware_shifted{};
+    reciprocal_shifted_t const reciprocal_shifted{reciprocal_divider};
+    auto const hardware_shifted_cycles
+        = run_benchmark(invariant_data, [&hardware_shifted](wide_t dividend, narrow_t divisor) {
+              return hardware_shifted(static_cast<uint64_t>(dividend), divisor, rounding_modes::div::nearest_even);
+          });
+    auto const reciprocal_shifted_cycles
+        = run_benchmark(invariant_data, [&reciprocal_shifted](wide_t dividend, narrow_t divisor) {
+              return reciprocal_shifted(static_cast<uint64_t>(dividend), divisor, rounding_modes::div::nearest_even);
+          });
+
     std::cout << std::fixed << std::setprecision(2);
     std::cout << "Compiler Baseline : " << compiler_cycles << " cycles/div\n";
     std::cout << "Inline Asm (x64)  : " << hardware_cycles << " cycles/div\n";
+    std::cout << "\nInvariant divisor:\n";
+    std::cout << "Compiler Baseline : " << invariant_compiler_cycles << " cycles/div\n";
+    std::cout << "Inline Asm (x64)  : " << invariant_hardware_cycles << " cycles/div\n";
+    std::cout << "Reciprocal        : " << reciprocal_cycles << " cycles/div\n";
+    std::cout << "Shifted, Asm      : " << hardware_shifted_cycles << " cycles/div\n";
+    std::cout << "Shifted, Recip.   : " << reciprocal_shifted_cycles << " cycles/div\n";
 
     return 0;
 }
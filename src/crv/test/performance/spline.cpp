@@ -0,0 +1,206 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/math/fixed/float_conversions.hpp>
+#include <crv/math/stats.hpp>
+#include <crv/spline/compact_payload.hpp>
+#include <crv/spline/locate_hint.hpp>
+#include <crv/spline/prod_spline.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <crv/test/performance/prod_spline_generator.hpp>
+#include <algorithm>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <span>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace crv {
+namespace {
+
+using spline_t = spline::prod_spline_t;
+using dyadic_spline_t = spline::prod_dyadic_spline_t;
+using hinted_spline_t = spline::spline_t<spline::prod_segment_t, spline::prod_extended_tangent_t,
+    spline::prod_segment_locator_t, spline::locate_hints::window_t<spline::prod_pipeline_config_t::x_t,
+                                        spline::locate_hints::counters_t>>;
+using x_t = spline_t::x_t;
+using y_t = spline_t::y_t;
+
+constexpr auto domain_end = float_t{1 << spline::prod_log2_domain_end};
+
+/// velocities following a clamped random walk, like real mouse motion; consecutive inputs usually share segments
+auto generate_random_walk(size_t sample_size, std::mt19937_64& rng) -> std::vector<x_t>
+{
+    auto data = std::vector<x_t>{};
+    data.reserve(sample_size);
+
+    auto step_dist = std::normal_distribution<float_t>{0.0, 0.5};
+    auto velocity = float_t{0.0};
+    for (size_t index = 0; index < sample_size; ++index)
+    {
+        velocity = std::clamp(velocity + step_dist(rng), 0.0, 1.25 * domain_end);
+        data.push_back(to_fixed<x_t>(velocity));
+    }
+
+    return data;
+}
+
+/// velocities drawn uniformly over the domain; consecutive inputs rarely share segments
+auto generate_uniform(size_t sample_size, std::mt19937_64& rng) -> std::vector<x_t>
+{
+    auto data = std::vector<x_t>{};
+    data.reserve(sample_size);
+
+    auto velocity_dist = std::uniform_real_distribution<float_t>{0.0, domain_end};
+    for (size_t index = 0; index < sample_size; ++index) data.push_back(to_fixed<x_t>(velocity_dist(rng)));
+
+    return data;
+}
+
+/// executes the microbenchmark on a callable that consumes the whole stream
+template <typename invocable_t>
+auto run_benchmark(std::vector<x_t> const& xs, std::vector<y_t>& ys, invocable_t&& func) -> float_t
+{
+    // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+    func(std::span{xs}, std::span{ys});
+    clobber_memory();
+
+    auto aux = uint32_t{0};
+
+    // timed pass
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    func(std::span{xs}, std::span{ys});
+    clobber_memory();
+
+    _mm_lfence();
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    auto const total_cycles = end_cycles - start_cycles;
+    return static_cast<float_t>(total_cycles) / static_cast<float_t>(xs.size());
+}
+
+/// dyadic_spline is null when the generated spline's segments are too fine for the dyadic locator
+auto report(std::string_view distribution, spline_t const& spline, dyadic_spline_t const* dyadic_spline,
+    std::vector<x_t> const& xs) -> void
+{
+    auto ys = std::vector<y_t>(xs.size());
+
+    auto const scalar_cycles = run_benchmark(xs, ys, [&](std::span<x_t const> xs, std::span<y_t> ys) {
+        for (auto index = 0u; index < xs.size(); ++index) ys[index] = spline(xs[index]);
+    });
+    auto const scalar_ys = ys;
+
+    auto const batch_cycles = run_benchmark(
+        xs, ys, [&](std::span<x_t const> xs, std::span<y_t> ys) { spline.evaluate(xs, ys); });
+
+    std::cout << distribution << ":\n";
+    std::cout << "    scalar : " << scalar_cycles << " cycles/input\n";
+    std::cout << "    batch  : " << batch_cycles << " cycles/input\n";
+    if (ys != scalar_ys) std::cout << "    ERROR: batch output differs from scalar output\n";
+
+    if (!dyadic_spline) return;
+
+    auto const dyadic_cycles = run_benchmark(xs, ys, [&](std::span<x_t const> xs, std::span<y_t> ys) {
+        for (auto index = 0u; index < xs.size(); ++index) ys[index] = (*dyadic_spline)(xs[index]);
+    });
+
+    std::cout << "    dyadic : " << dyadic_cycles << " cycles/input\n";
+    if (ys != scalar_ys) std::cout << "    ERROR: dyadic output differs from scalar output\n";
+}
+
+/// samples the latency of each evaluation separately; the fences keep consecutive evaluations from overlapping
+///
+/// Evaluations go through one cursor, as a single source's reports would.
+template <typename spline_t> auto measure_latency(spline_t const& spline, std::vector<x_t> const& xs)
+    -> std::pair<distribution_t<int_t>, typename spline_t::cursor_t>
+{
+    auto cursor = typename spline_t::cursor_t{};
+    auto result = distribution_t<int_t>{};
+    auto aux = uint32_t{0};
+
+    for (auto const x : xs)
+    {
+        _mm_lfence();
+        auto const start_cycles = __rdtsc();
+        _mm_lfence();
+
+        do_not_optimize(spline(x, cursor));
+
+        auto const end_cycles = __rdtscp(&aux);
+        _mm_lfence();
+
+        result.sample(static_cast<int_t>(end_cycles - start_cycles));
+    }
+
+    return {result, cursor};
+}
+
+/// compares latency distributions of the branchless descent and the hinted locate
+///
+/// Latencies include the fences and timer reads, so compare them against each other rather than the throughput numbers.
+auto report_latency(std::string_view distribution, spline_t const& spline, hinted_spline_t const& hinted_spline,
+    std::vector<x_t> const& xs) -> void
+{
+    auto const [descent_latency, descent_cursor] = measure_latency(spline, xs);
+    auto const [hinted_latency, hinted_cursor] = measure_latency(hinted_spline, xs);
+    auto const& counters = hinted_cursor.locate_hint().counters();
+    auto const hit_rate = static_cast<float_t>(counters.hits) / static_cast<float_t>(counters.hits + counters.misses);
+
+    std::cout << distribution << " latency (cycles):\n";
+    std::cout << "    descent: " << descent_latency << "\n";
+    std::cout << "    hinted : " << hinted_latency << "\n";
+    std::cout << "    hinted hit rate: " << 100.0 * hit_rate << "%\n";
+}
+
+auto main() -> int
+{
+    constexpr auto const sample_size = 10'000'000u;
+
+    std::cout << "Generating spline...\n";
+    auto const spline = spline::generate_prod_spline();
+    std::cout << "Spline has " << spline.payload.segment_locator.segment_count() << " segments, "
+              << spline.payload.segment_locator.depth() << " tree levels.\n";
+    std::cout << "Payload is " << sizeof(spline.payload) << " bytes, "
+              << spline::compact_payload_codec_t<spline_t>::size(spline.payload.segment_locator.segment_count())
+              << " bytes compact.\n";
+
+    // same spline, assembled into the dyadic locator
+    auto const dyadic_spline = spline::generate_prod_spline<dyadic_spline_t>();
+    auto const* const valid_dyadic_spline = dyadic_spline.is_valid() ? &dyadic_spline : nullptr;
+    if (!valid_dyadic_spline) std::cout << "Spline segments are too fine for the dyadic locator; skipping it.\n";
+
+    // same spline again, locating through a window over the previous segment
+    auto const hinted_spline = spline::generate_prod_spline<hinted_spline_t>();
+
+    std::cout << "Generating " << sample_size << " test cases per distribution...\n";
+    auto rng = std::mt19937_64(std::random_device{}());
+    auto const random_walk = generate_random_walk(sample_size, rng);
+    auto const uniform = generate_uniform(sample_size, rng);
+    std::cout << "Data generated. Running benchmark...\n\n";
+
+    std::cout << std::fixed << std::setprecision(5);
+    report("Random walk", spline, valid_dyadic_spline, random_walk);
+    report("Uniform", spline, valid_dyadic_spline, uniform);
+    std::cout << "\n";
+    report_latency("Random walk", spline, hinted_spline, random_walk);
+    report_latency("Uniform", spline, hinted_spline, uniform);
+
+    return 0;
+}
+
+} // namespace
+} // namespace crv
+
+auto main() -> int
+{
+    return crv::main();
+}
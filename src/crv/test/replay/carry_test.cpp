@@ -0,0 +1,145 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief replays long traces to prove the remainder carry loses no counts
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "trace.hpp"
+#include <crv/input/pipeline.hpp>
+#include <crv/test/performance/prod_spline_generator.hpp>
+#include <crv/test/test.hpp>
+#include <random>
+#include <linux/input.h>
+
+namespace crv::replay {
+namespace {
+
+using scaled_t = input::prod_accelerator_t::scaled_t;
+
+/// slow motion polled at a jittery 1 kHz, where every report's fraction is a large part of its total
+auto generate_trace(int_t report_count, int32_t x_sign, int32_t y_sign, int_t reversal_period) -> trace_t
+{
+    auto rng = std::mt19937{0x5eed};
+    auto counts = std::uniform_int_distribution<int32_t>{0, 3};
+    auto intervals_us = std::uniform_int_distribution<int64_t>{800, 1200};
+
+    auto result = trace_t{};
+    result.reserve(static_cast<std::size_t>(report_count * 3));
+    auto time_us = int64_t{0};
+    for (auto report = 0; report < report_count; ++report)
+    {
+        time_us += intervals_us(rng);
+        if (reversal_period && report && report % reversal_period == 0)
+        {
+            x_sign = -x_sign;
+            y_sign = -y_sign;
+        }
+
+        result.push_back({.time_us = time_us, .type = EV_REL, .code = REL_X, .value = x_sign * counts(rng)});
+        result.push_back({.time_us = time_us, .type = EV_REL, .code = REL_Y, .value = y_sign * counts(rng)});
+        result.push_back({.time_us = time_us, .type = EV_SYN, .code = SYN_REPORT, .value = 0});
+    }
+    return result;
+}
+
+struct axis_totals_t
+{
+    scaled_t exact{};
+    scaled_t emitted_and_carried{};
+    int_t reversal_count = 0;
+};
+
+struct totals_t
+{
+    axis_totals_t x;
+    axis_totals_t y;
+};
+
+struct replay_carry_test_t : Test
+{
+    static auto SetUpTestSuite() -> void { input::active_spline().publish(spline::generate_prod_spline()); }
+
+    /// feeds trace through a source, as the input handler would, while scaling the same reports at the same velocities
+    /// exactly
+    auto replay(trace_t const& trace) -> totals_t
+    {
+        auto& source = *crv_source_attach(&trace, "replay");
+        auto const accelerator = input::prod_accelerator_t{};
+        auto estimator = input::prod_velocity_estimator_t{};
+
+        auto result = totals_t{};
+        auto emitted_x = scaled_t{};
+        auto emitted_y = scaled_t{};
+        auto prev_x = scaled_t{};
+        auto prev_y = scaled_t{};
+
+        auto const count_reversal = [](axis_totals_t& totals, scaled_t& prev, scaled_t scaled) {
+            if (!scaled) return;
+            if (prev && (prev.value < 0) != (scaled.value < 0)) ++totals.reversal_count;
+            prev = scaled;
+        };
+
+        for (auto const& event : trace)
+        {
+            if (event.type == EV_REL && event.code == REL_X) crv_source_move(&source, event.value, 0);
+            else if (event.type == EV_REL && event.code == REL_Y) crv_source_move(&source, 0, event.value);
+            else if (event.type == EV_SYN && event.code == SYN_REPORT)
+            {
+                // sources only measure reports with motion
+                if (source.pending == input::motion_t{}) continue;
+
+                auto const velocity = estimator(event.time_us, accelerator.speed(source.pending));
+                auto const exact = input::active_spline().read(
+                    [&](auto const& spline) { return accelerator.scale(source.pending, spline, velocity); });
+                result.x.exact += exact.x;
+                result.y.exact += exact.y;
+                count_reversal(result.x, prev_x, exact.x);
+                count_reversal(result.y, prev_y, exact.y);
+
+                auto output = crv_motion{};
+                if (crv_source_report(&source, event.time_us, &output))
+                {
+                    emitted_x += scaled_t{output.x};
+                    emitted_y += scaled_t{output.y};
+                }
+            }
+        }
+
+        result.x.emitted_and_carried = emitted_x + source.remainder_x.carry();
+        result.y.emitted_and_carried = emitted_y + source.remainder_y.carry();
+
+        crv_source_detach(&source);
+        return result;
+    }
+};
+
+TEST_F(replay_carry_test_t, steady_motion_loses_no_counts)
+{
+    auto const totals = replay(generate_trace(100'000, 1, -1, 0));
+
+    ASSERT_NE(scaled_t{}, totals.x.exact);
+    ASSERT_NE(scaled_t{}, totals.y.exact);
+
+    // without reversals, nothing is ever dropped; everything scaled was either emitted or is still carried
+    EXPECT_EQ(totals.x.exact, totals.x.emitted_and_carried);
+    EXPECT_EQ(totals.y.exact, totals.y.emitted_and_carried);
+}
+
+TEST_F(replay_carry_test_t, reversals_drop_at_most_half_a_count_each)
+{
+    auto const totals = replay(generate_trace(100'000, 1, 1, 97));
+
+    auto const expect_bounded = [](axis_totals_t const& totals) {
+        ASSERT_NE(0, totals.reversal_count);
+
+        auto const error = totals.exact - totals.emitted_and_carried;
+        auto const bound = scaled_t::literal(totals.reversal_count * (scaled_t{1}.value >> 1));
+        EXPECT_LE(-bound, error);
+        EXPECT_LE(error, bound);
+    };
+    expect_bounded(totals.x);
+    expect_bounded(totals.y);
+}
+
+} // namespace
+} // namespace crv::replay
@@ -0,0 +1,251 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief replays recorded evdev traces through the kernel module's input pipeline in user mode
+///
+/// The pipeline's translation units are in the kernel manifest, so the library builds them with the same freestanding
+/// flags Kbuild uses. This drives them through their c interface exactly as the input handler does: REL_X and REL_Y
+/// feed crv_source_move(), and SYN_REPORT calls crv_source_report(). Other events pass through the kernel without
+/// touching the pipeline, so they are skipped here.
+///
+/// Each call is timed separately and reported as percentiles. With --deltas, each report's input and output motion
+/// are printed one per line, so two runs can be diffed to catch behavior changes.
+///
+/// usage: replay [--identity] [--deltas] [--filter-halflife=ms] trace...
+///
+/// Traces may be evtest output, libinput record output, or raw captures of /dev/input/eventN. By default, the replay
+/// publishes a generated production spline first; --identity leaves the pipeline unpublished, so motion passes
+/// through. --filter-halflife enables velocity smoothing, as profile_t::filter_halflife does.
+///
+/// The velocity smoother is also timed on its own, on each trace's reports, so its share of a report is visible.
+///
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include <crv/lib.hpp>
+#include <crv/input/pipeline.hpp>
+#include <crv/math/stats.hpp>
+#include <crv/test/performance/performance.hpp>
+#include <crv/test/performance/prod_spline_generator.hpp>
+#include <crv/test/replay/trace.hpp>
+#include <charconv>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+#include <linux/input.h>
+
+namespace crv::replay {
+namespace {
+
+struct options_t
+{
+    bool identity = false;
+    bool deltas = false;
+    int64_t filter_halflife_us = 0;
+    std::vector<std::string_view> paths{};
+};
+
+constexpr auto filter_halflife_option = std::string_view{"--filter-halflife="};
+
+auto parse_options(std::span<char* const> args) -> std::optional<options_t>
+{
+    auto result = options_t{};
+    for (auto const arg : args.subspan(1))
+    {
+        auto const option = std::string_view{arg};
+        if (option == "--identity") result.identity = true;
+        else if (option == "--deltas") result.deltas = true;
+        else if (option.starts_with(filter_halflife_option))
+        {
+            auto const value = option.substr(filter_halflife_option.size());
+            auto halflife_ms = 0.0;
+            auto const [end, error] = std::from_chars(value.data(), value.data() + value.size(), halflife_ms);
+            if (error != std::errc{} || end != value.data() + value.size() || halflife_ms < 0) return std::nullopt;
+            result.filter_halflife_us = std::llround(halflife_ms * 1000);
+        }
+        else if (option.starts_with("--")) return std::nullopt;
+        else result.paths.push_back(option);
+    }
+
+    if (result.paths.empty()) return std::nullopt;
+    return result;
+}
+
+/// times one call into the pipeline; the fences keep consecutive calls from overlapping
+template <typename invocable_t> auto time(invocable_t&& invocable) noexcept -> int_t
+{
+    auto aux = uint32_t{0};
+
+    _mm_lfence();
+    auto const start_cycles = __rdtsc();
+    _mm_lfence();
+
+    invocable();
+
+    auto const end_cycles = __rdtscp(&aux);
+    _mm_lfence();
+
+    return static_cast<int_t>(end_cycles - start_cycles);
+}
+
+struct results_t
+{
+    distribution_t<int_t> moves{};
+    distribution_t<int_t> reports{};
+    distribution_t<int_t> smoother{};
+    int_t move_count = 0;
+    int_t report_count = 0;
+    int_t total_cycles = 0;
+    int64_t in_x = 0;
+    int64_t in_y = 0;
+    int64_t out_x = 0;
+    int64_t out_y = 0;
+};
+
+/// feeds trace through a freshly attached source, as the input handler would for one device
+auto replay(trace_t const& trace, options_t const& options, bool print_deltas) -> results_t
+{
+    auto result = results_t{};
+    auto& source = *crv_source_attach(&trace, "replay");
+
+    // identity transform and no notch, as a device with default config would have
+    constexpr auto one = input::transform_t::coeff_t{1}.value;
+    auto const config = crv_source_config{
+        .transform = {.xx = one, .xy = 0, .yx = 0, .yy = one},
+        .notch_threshold = 0,
+        .filter_halflife_us = options.filter_halflife_us,
+    };
+    crv_source_configure(&source, &config);
+
+    for (auto const& event : trace)
+    {
+        if (event.type == EV_REL && (event.code == REL_X || event.code == REL_Y))
+        {
+            auto const x = event.code == REL_X ? event.value : 0;
+            auto const y = event.code == REL_Y ? event.value : 0;
+            auto const cycles = time([&] { crv_source_move(&source, x, y); });
+
+            result.moves.sample(cycles);
+            result.total_cycles += cycles;
+            ++result.move_count;
+        }
+        else if (event.type == EV_SYN && event.code == SYN_REPORT)
+        {
+            auto const input = source.pending;
+            auto output = crv_motion{};
+            auto emitted = 0;
+            auto const cycles = time([&] { emitted = crv_source_report(&source, event.time_us, &output); });
+
+            result.reports.sample(cycles);
+            result.total_cycles += cycles;
+            ++result.report_count;
+
+            // input counts even when carry rounds its output to nothing; that output arrives with a later report
+            result.in_x += input.x;
+            result.in_y += input.y;
+
+            if (!emitted) continue;
+
+            result.out_x += output.x;
+            result.out_y += output.y;
+
+            if (print_deltas)
+            {
+                std::cout << event.time_us << " " << input.x << " " << input.y << " " << output.x << " " << output.y
+                          << "\n";
+            }
+        }
+    }
+
+    crv_source_detach(&source);
+    return result;
+}
+
+/// times the velocity smoother alone on each of trace's reports
+auto benchmark_smoother(trace_t const& trace, options_t const& options) -> distribution_t<int_t>
+{
+    constexpr auto accelerator = input::prod_accelerator_t{};
+    auto estimator = input::prod_velocity_estimator_t{};
+    auto smoother = input::prod_smoother_t{};
+    smoother.halflife_us(options.filter_halflife_us);
+
+    auto result = distribution_t<int_t>{};
+    auto pending = input::motion_t{};
+    for (auto const& event : trace)
+    {
+        if (event.type == EV_REL && event.code == REL_X) pending.x += event.value;
+        else if (event.type == EV_REL && event.code == REL_Y) pending.y += event.value;
+        else if (event.type == EV_SYN && event.code == SYN_REPORT && pending != input::motion_t{})
+        {
+            auto const velocity = estimator(event.time_us, accelerator.speed(pending));
+            auto const interval_us = estimator.interval_us();
+            result.sample(time([&] { do_not_optimize(smoother(velocity, interval_us)); }));
+            pending = {};
+        }
+    }
+
+    return result;
+}
+
+auto print(std::string_view path, results_t const& results) -> void
+{
+    auto const event_count = results.move_count + results.report_count;
+    auto const mean_cycles = event_count ? static_cast<float_t>(results.total_cycles) / event_count : float_t{0};
+
+    std::cout << path << ":\n";
+    std::cout << "    events  : " << event_count << " (" << results.move_count << " moves, " << results.report_count
+              << " reports)\n";
+    std::cout << "    mean    : " << mean_cycles << " cycles/event\n";
+    std::cout << "    moves   : " << results.moves << " cycles\n";
+    std::cout << "    reports : " << results.reports << " cycles\n";
+    std::cout << "    smoother: " << results.smoother << " cycles\n";
+    std::cout << "    motion  : in (" << results.in_x << ", " << results.in_y << "), out (" << results.out_x << ", "
+              << results.out_y << ")\n";
+}
+
+auto main(std::span<char* const> args) -> int
+{
+    auto const options = parse_options(args);
+    if (!options)
+    {
+        std::cerr << "usage: " << args[0] << " [--identity] [--deltas] [--filter-halflife=ms] trace...\n";
+        return 2;
+    }
+
+    if (!options->identity) input::active_spline().publish(spline::generate_prod_spline());
+
+    std::cout << std::fixed << std::setprecision(2);
+
+    auto status = 0;
+    for (auto const path : options->paths)
+    {
+        auto const trace = load(path);
+        if (!trace)
+        {
+            std::cerr << path << ": could not read trace\n";
+            status = 1;
+            continue;
+        }
+
+        // warmup pass; primes the instruction cache and branch predictor so cold misses don't skew the results
+        replay(*trace, *options, false);
+        benchmark_smoother(*trace, *options);
+
+        auto results = replay(*trace, *options, options->deltas);
+        results.smoother = benchmark_smoother(*trace, *options);
+        print(path, results);
+    }
+
+    return status;
+}
+
+} // namespace
+} // namespace crv::replay
+
+auto main(int argc, char* argv[]) -> int
+{
+    return crv::replay::main(std::span{argv, static_cast<std::size_t>(argc)});
+}
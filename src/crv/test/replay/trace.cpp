@@ -0,0 +1,165 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "trace.hpp"
+#include <algorithm>
+#include <charconv>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+#include <string>
+#include <linux/input.h>
+
+namespace crv::replay {
+namespace {
+
+constexpr auto us_per_s = int64_t{1'000'000};
+
+auto skip_spaces(std::string_view& text) noexcept -> void
+{
+    auto const first = text.find_first_not_of(' ');
+    text.remove_prefix(first == std::string_view::npos ? text.size() : first);
+}
+
+/// removes expected from the front of text
+auto consume(std::string_view& text, std::string_view expected) noexcept -> bool
+{
+    if (!text.starts_with(expected)) return false;
+    text.remove_prefix(expected.size());
+    return true;
+}
+
+/// removes everything through the first occurrence of expected
+auto consume_through(std::string_view& text, std::string_view expected) noexcept -> bool
+{
+    auto const position = text.find(expected);
+    if (position == std::string_view::npos) return false;
+    text.remove_prefix(position + expected.size());
+    return true;
+}
+
+/// removes a decimal integer from the front of text, after any spaces
+auto consume_int(std::string_view& text) noexcept -> std::optional<int64_t>
+{
+    skip_spaces(text);
+
+    auto value = int64_t{};
+    auto const [end, error] = std::from_chars(text.data(), text.data() + text.size(), value);
+    if (error != std::errc{}) return std::nullopt;
+
+    text.remove_prefix(static_cast<std::size_t>(end - text.data()));
+    return value;
+}
+
+auto parse_evtest(std::string_view line) -> std::optional<event_t>
+{
+    if (!consume(line, "Event: time ")) return std::nullopt;
+
+    auto const s = consume_int(line);
+    if (!s || !consume(line, ".")) return std::nullopt;
+    auto const us = consume_int(line);
+    if (!us) return std::nullopt;
+
+    auto const time_us = *s * us_per_s + *us;
+
+    // evtest prints reports as a banner rather than a type and code
+    if (line.find("SYN_REPORT") != std::string_view::npos)
+    {
+        return event_t{.time_us = time_us, .type = EV_SYN, .code = SYN_REPORT, .value = 0};
+    }
+
+    if (!consume(line, ", type ")) return std::nullopt;
+    auto const type = consume_int(line);
+    if (!type || !consume_through(line, ", code ")) return std::nullopt;
+    auto const code = consume_int(line);
+    if (!code || !consume_through(line, ", value ")) return std::nullopt;
+    auto const value = consume_int(line);
+    if (!value) return std::nullopt;
+
+    return event_t{.time_us = time_us,
+        .type = static_cast<uint16_t>(*type),
+        .code = static_cast<uint16_t>(*code),
+        .value = static_cast<int32_t>(*value)};
+}
+
+auto parse_libinput_record(std::string_view line) -> std::optional<event_t>
+{
+    skip_spaces(line);
+    if (!consume(line, "-")) return std::nullopt;
+    skip_spaces(line);
+    if (!consume(line, "[")) return std::nullopt;
+
+    int64_t fields[5];
+    for (auto index = 0; index < 5; ++index)
+    {
+        if (index && !consume(line, ",")) return std::nullopt;
+        auto const field = consume_int(line);
+        if (!field) return std::nullopt;
+        fields[index] = *field;
+    }
+
+    skip_spaces(line);
+    if (!consume(line, "]")) return std::nullopt;
+
+    return event_t{.time_us = fields[0] * us_per_s + fields[1],
+        .type = static_cast<uint16_t>(fields[2]),
+        .code = static_cast<uint16_t>(fields[3]),
+        .value = static_cast<int32_t>(fields[4])};
+}
+
+} // namespace
+
+auto parse_line(std::string_view line) -> std::optional<event_t>
+{
+    if (auto const event = parse_evtest(line)) return event;
+    return parse_libinput_record(line);
+}
+
+auto parse_text(std::istream& in) -> trace_t
+{
+    auto result = trace_t{};
+    auto line = std::string{};
+    while (std::getline(in, line))
+    {
+        if (auto const event = parse_line(line)) result.push_back(*event);
+    }
+    return result;
+}
+
+auto parse_binary(std::span<std::byte const> bytes) -> std::optional<trace_t>
+{
+    if (bytes.size() % sizeof(input_event)) return std::nullopt;
+
+    auto result = trace_t{};
+    result.reserve(bytes.size() / sizeof(input_event));
+    for (auto offset = std::size_t{0}; offset < bytes.size(); offset += sizeof(input_event))
+    {
+        auto event = input_event{};
+        std::memcpy(&event, bytes.data() + offset, sizeof(event));
+        result.push_back({.time_us = static_cast<int64_t>(event.input_event_sec) * us_per_s + event.input_event_usec,
+            .type = event.type,
+            .code = event.code,
+            .value = event.value});
+    }
+    return result;
+}
+
+auto load(std::filesystem::path const& path) -> std::optional<trace_t>
+{
+    auto file = std::ifstream{path, std::ios::binary};
+    if (!file) return std::nullopt;
+
+    auto const contents = std::string{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    if (file.bad()) return std::nullopt;
+
+    // text dumps never contain nul; binary captures always do, in the high bytes of their timestamps
+    if (std::ranges::find(contents, '\0') != contents.end()) return parse_binary(std::as_bytes(std::span{contents}));
+
+    auto text = std::istringstream{contents};
+    return parse_text(text);
+}
+
+} // namespace crv::replay
@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \brief loads recorded evdev traces for replay
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#pragma once
+
+#include <crv/lib.hpp>
+#include <cstddef>
+#include <filesystem>
+#include <istream>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+namespace crv::replay {
+
+/// one evdev event, as recorded
+struct event_t
+{
+    int64_t time_us; ///< microseconds since the recording's epoch
+    uint16_t type;
+    uint16_t code;
+    int32_t value;
+
+    constexpr auto operator==(event_t const&) const noexcept -> bool = default;
+};
+
+using trace_t = std::vector<event_t>;
+
+/// parses one line of evtest or libinput record output
+///
+/// evtest lines look like:
+///
+///     Event: time 1700000000.000123, type 2 (EV_REL), code 0 (REL_X), value 3
+///     Event: time 1700000000.000123, -------------- SYN_REPORT ------------
+///
+/// libinput record lines look like:
+///
+///     - [  0,    123,   2,   0,       3] # EV_REL / REL_X                    3
+///
+/// \returns nullopt for lines that don't hold an event, like headers and device descriptions
+auto parse_line(std::string_view line) -> std::optional<event_t>;
+
+/// parses every event line of an evtest or libinput record dump, skipping everything else
+auto parse_text(std::istream& in) -> trace_t;
+
+/// parses a raw capture of struct input_event, as read from /dev/input/eventN
+///
+/// \returns nullopt if bytes is not a whole number of events
+auto parse_binary(std::span<std::byte const> bytes) -> std::optional<trace_t>;
+
+/// loads a trace file, treating it as binary if it contains nul bytes, text otherwise
+///
+/// \returns nullopt if the file can't be read or a binary trace is truncated
+auto load(std::filesystem::path const& path) -> std::optional<trace_t>;
+
+} // namespace crv::replay
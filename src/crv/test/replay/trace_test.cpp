@@ -0,0 +1,114 @@
+// SPDX-License-Identifier: MIT
+
+/// \file
+/// \copyright Copyright (C) 2026 Frank Secilia
+
+#include "trace.hpp"
+#include <crv/test/test.hpp>
+#include <cstring>
+#include <sstream>
+#include <vector>
+#include <linux/input.h>
+
+namespace crv::replay {
+namespace {
+
+// ====================================================================================================================
+// evtest
+// ====================================================================================================================
+
+TEST(trace_test, parses_evtest_event)
+{
+    EXPECT_EQ((event_t{.time_us = 1'700'000'000'000'123, .type = EV_REL, .code = REL_Y, .value = -3}),
+        parse_line("Event: time 1700000000.000123, type 2 (EV_REL), code 1 (REL_Y), value -3"));
+}
+
+TEST(trace_test, parses_evtest_report_banner)
+{
+    EXPECT_EQ((event_t{.time_us = 2'000'005, .type = EV_SYN, .code = SYN_REPORT, .value = 0}),
+        parse_line("Event: time 2.000005, -------------- SYN_REPORT ------------"));
+}
+
+TEST(trace_test, skips_evtest_headers)
+{
+    EXPECT_EQ(std::nullopt, parse_line("Input driver version is 1.0.1"));
+    EXPECT_EQ(std::nullopt, parse_line("    Event code 0 (REL_X)"));
+    EXPECT_EQ(std::nullopt, parse_line("Event: time 1.5, type"));
+}
+
+// ====================================================================================================================
+// libinput record
+// ====================================================================================================================
+
+TEST(trace_test, parses_libinput_record_event)
+{
+    EXPECT_EQ((event_t{.time_us = 3'000'123, .type = EV_REL, .code = REL_X, .value = 7}),
+        parse_line("      - [  3,    123,   2,   0,       7] # EV_REL / REL_X                    7"));
+}
+
+TEST(trace_test, skips_libinput_record_headers)
+{
+    EXPECT_EQ(std::nullopt, parse_line("- evdev:"));
+    EXPECT_EQ(std::nullopt, parse_line("  - [1, 2, 3]"));
+    EXPECT_EQ(std::nullopt, parse_line("  - [1, 2, 3, 4, 5"));
+}
+
+TEST(trace_test, parses_mixed_text)
+{
+    auto in = std::istringstream{"Input driver version is 1.0.1\n"
+                                 "Event: time 1.000000, type 2 (EV_REL), code 0 (REL_X), value 1\n"
+                                 "Event: time 1.000000, -------------- SYN_REPORT ------------\n"
+                                 "  - [  1,   8000,   2,   1,      -2] # EV_REL / REL_Y\n"};
+
+    auto const expected = trace_t{
+        {.time_us = 1'000'000, .type = EV_REL, .code = REL_X, .value = 1},
+        {.time_us = 1'000'000, .type = EV_SYN, .code = SYN_REPORT, .value = 0},
+        {.time_us = 1'008'000, .type = EV_REL, .code = REL_Y, .value = -2},
+    };
+    EXPECT_EQ(expected, parse_text(in));
+}
+
+// ====================================================================================================================
+// binary
+// ====================================================================================================================
+
+auto to_bytes(std::vector<input_event> const& events) -> std::vector<std::byte>
+{
+    auto result = std::vector<std::byte>(events.size() * sizeof(input_event));
+    std::memcpy(result.data(), events.data(), result.size());
+    return result;
+}
+
+auto make_input_event(int64_t s, int64_t us, uint16_t type, uint16_t code, int32_t value) -> input_event
+{
+    auto result = input_event{};
+    result.input_event_sec = s;
+    result.input_event_usec = us;
+    result.type = type;
+    result.code = code;
+    result.value = value;
+    return result;
+}
+
+TEST(trace_test, parses_binary_capture)
+{
+    auto const bytes = to_bytes({
+        make_input_event(4, 10, EV_REL, REL_X, -5),
+        make_input_event(4, 10, EV_SYN, SYN_REPORT, 0),
+    });
+
+    auto const expected = trace_t{
+        {.time_us = 4'000'010, .type = EV_REL, .code = REL_X, .value = -5},
+        {.time_us = 4'000'010, .type = EV_SYN, .code = SYN_REPORT, .value = 0},
+    };
+    EXPECT_EQ(expected, parse_binary(bytes));
+}
+
+TEST(trace_test, rejects_truncated_binary_capture)
+{
+    auto const bytes = to_bytes({make_input_event(4, 10, EV_REL, REL_X, -5)});
+    EXPECT_EQ(std::nullopt, parse_binary(std::span{bytes}.first(bytes.size() - 1)));
+}
+
+} // namespace
+} // namespace crv::replay
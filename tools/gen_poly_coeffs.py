@@ -0,0 +1,285 @@
+#!/usr/bin/env python3
+"""
+Generate coefficients and shifts for the fixed-point polynomial kernels.
+
+Each kernel approximates f over [0, 1] with a polynomial whose endpoints are
+pinned, p(0) = f(0) = 0 and p(1) = f(1), so results meet where eval() carries
+into the integer part.
+
+Fit:
+  With no constant term, p(0) = 0. Solving c1 + ... + cn = f(1) for c1 turns
+  each remaining basis function into x^k - x, so the free coefficients
+  c2..cn minimize
+
+      max |(f(x) - f(1)*x) - sum(ck*(x^k - x))|   over [0, 1]
+
+  The basis functions all vanish at both endpoints, and so does the
+  function, so the error is 0 there. Dividing through by x*(x - 1) leaves
+  a polynomial of degree n - 2, which is a Haar system on (0, 1), so the
+  minimax solution equioscillates at n interior points. The Remez exchange
+  finds it.
+
+  Ref: Cheney, E.W., "Introduction to Approximation Theory", 1966, ch. 3.
+
+Rounding:
+  Each of c2..cn is rounded to nearest in its Q format. c1 is then solved
+  from the rounded coefficients and rounded in turn, so p(1) misses f(1) by
+  c1's rounding alone.
+
+Q formats:
+  Horner's method computes h_k = c_k + x*h_(k+1). c_k is stored in the
+  format of max |h_k| over the domain, with coeff_precision bits, so every
+  step keeps all its bits significant without overflowing.
+
+Output:
+  The approx error line, measured with the coefficients as stored, the
+  degree, the coefficient table for the .cpp, and the shift table for the
+  .hpp, in the layout the kernels use.
+
+Working precision: 80 decimal digits (decimal).
+
+Usage:   python3 gen_poly_coeffs.py {prod_exp2|log2}
+"""
+import decimal
+import sys
+from decimal import Decimal
+
+decimal.getcontext().prec = 80
+
+LN2 = Decimal(2).ln()
+
+# ──────────────────────────────────────────────────────────────────────
+# Kernels
+# ──────────────────────────────────────────────────────────────────────
+KERNELS = {
+    "prod_exp2": {
+        "func": lambda x: (x * LN2).exp() - 1,
+        "degree": 12,
+        "coeff_precision": 64,
+        "coeff_type": "uint64_t",
+        "coeff_suffix": "ULL",
+        "class_name": "prod_exp2_t",
+    },
+    "log2": {
+        "func": lambda x: (1 + x).ln() / LN2,
+        "degree": 14,
+        "coeff_precision": 63,
+        "coeff_type": "int64_t",
+        "coeff_suffix": "LL",
+        "class_name": "log2_t",
+    },
+}
+
+# ──────────────────────────────────────────────────────────────────────
+# Numerics
+# ──────────────────────────────────────────────────────────────────────
+GRID_SIZE = 4000
+GOLDEN_ITERATIONS = 120
+REMEZ_TOLERANCE = Decimal("1e-12")
+REMEZ_MAX_ITERATIONS = 50
+
+PI = Decimal("3.14159265358979323846264338327950288419716939937510582097494459230781640628620899863")
+
+
+def cos(x):
+    """Taylor series; converges quickly for |x| <= pi."""
+    term = Decimal(1)
+    total = Decimal(1)
+    k = 0
+    while True:
+        k += 2
+        term = -term * x * x / (k * (k - 1))
+        if abs(term) < Decimal(10) ** -(decimal.getcontext().prec + 2):
+            return total
+        total += term
+
+
+def solve(matrix, rhs):
+    """Gaussian elimination with partial pivoting."""
+    n = len(rhs)
+    a = [row[:] + [rhs[i]] for i, row in enumerate(matrix)]
+    for col in range(n):
+        pivot = max(range(col, n), key=lambda r: abs(a[r][col]))
+        a[col], a[pivot] = a[pivot], a[col]
+        for row in range(col + 1, n):
+            factor = a[row][col] / a[col][col]
+            for k in range(col, n + 1):
+                a[row][k] -= factor * a[col][k]
+    result = [Decimal(0)] * n
+    for row in reversed(range(n)):
+        acc = a[row][n] - sum(a[row][k] * result[k] for k in range(row + 1, n))
+        result[row] = acc / a[row][row]
+    return result
+
+
+def horner(coeffs, x):
+    """coeffs[k] multiplies x^k."""
+    acc = Decimal(0)
+    for c in reversed(coeffs):
+        acc = acc * x + c
+    return acc
+
+
+def golden_max(g, lo, hi):
+    """Maximizes g over [lo, hi], assuming one peak."""
+    ratio = (Decimal(5).sqrt() - 1) / 2
+    a, b = lo, hi
+    c = b - ratio * (b - a)
+    d = a + ratio * (b - a)
+    gc, gd = g(c), g(d)
+    for _ in range(GOLDEN_ITERATIONS):
+        if gc > gd:
+            b, d, gd = d, c, gc
+            c = b - ratio * (b - a)
+            gc = g(c)
+        else:
+            a, c, gc = c, d, gd
+            d = a + ratio * (b - a)
+            gd = g(d)
+    x = (a + b) / 2
+    return x, g(x)
+
+
+def sup_norm(g):
+    """max |g| over [0, 1], from a grid refined around its largest point."""
+    grid = [Decimal(i) / GRID_SIZE for i in range(GRID_SIZE + 1)]
+    values = [abs(g(x)) for x in grid]
+    best = max(range(len(grid)), key=lambda i: values[i])
+    lo = grid[max(best - 1, 0)]
+    hi = grid[min(best + 1, GRID_SIZE)]
+    _, refined = golden_max(lambda x: abs(g(x)), lo, hi)
+    return max(values[best], refined)
+
+
+def local_extrema(e):
+    """Alternating extrema of e over (0, 1), one per run of constant sign, refined."""
+    grid = [Decimal(i) / GRID_SIZE for i in range(1, GRID_SIZE)]
+    values = [e(x) for x in grid]
+
+    runs = []
+    start = 0
+    for i in range(1, len(grid) + 1):
+        if i == len(grid) or (values[i] > 0) != (values[start] > 0):
+            best = max(range(start, i), key=lambda j: abs(values[j]))
+            runs.append(best)
+            start = i
+
+    extrema = []
+    for best in runs:
+        sign = 1 if values[best] > 0 else -1
+        lo = grid[best - 1] if best > 0 else Decimal(0)
+        hi = grid[best + 1] if best + 1 < len(grid) else Decimal(1)
+        x, _ = golden_max(lambda t: sign * e(t), lo, hi)
+        extrema.append(x)
+    return extrema
+
+
+# ──────────────────────────────────────────────────────────────────────
+# Constrained Remez exchange
+# ──────────────────────────────────────────────────────────────────────
+def fit(func, degree):
+    """\returns c2..cn, unrounded, minimizing the constrained error."""
+    f1 = func(Decimal(1))
+
+    def target(x):
+        return func(x) - f1 * x
+
+    def basis(k, x):
+        return x**k - x
+
+    powers = range(2, degree + 1)
+    count = degree  # degree - 1 coefficients, plus the levelled error
+
+    reference = [(1 - cos(PI * (i + 1) / (count + 1))) / 2 for i in range(count)]
+    coeffs = None
+    for _ in range(REMEZ_MAX_ITERATIONS):
+        matrix = [[basis(k, x) for k in powers] + [Decimal((-1) ** i)] for i, x in enumerate(reference)]
+        solution = solve(matrix, [target(x) for x in reference])
+        coeffs, levelled = solution[:-1], abs(solution[-1])
+
+        def error(x, coeffs=coeffs):
+            return target(x) - sum(c * basis(k, x) for c, k in zip(coeffs, powers))
+
+        extrema = local_extrema(error)
+        while len(extrema) > count:
+            # drop whichever end deviates least
+            if abs(error(extrema[0])) < abs(error(extrema[-1])):
+                extrema.pop(0)
+            else:
+                extrema.pop()
+        if len(extrema) < count:
+            sys.exit(f"error: found {len(extrema)} alternating extrema, need {count}")
+
+        peak = max(abs(error(x)) for x in extrema)
+        reference = extrema
+        if peak - levelled <= REMEZ_TOLERANCE * peak:
+            return coeffs
+
+    sys.exit("error: remez exchange did not converge")
+
+
+# ──────────────────────────────────────────────────────────────────────
+# Generate
+# ──────────────────────────────────────────────────────────────────────
+def main(name):
+    kernel = KERNELS[name]
+    func = kernel["func"]
+    degree = kernel["degree"]
+    precision = kernel["coeff_precision"]
+
+    print(f"Fitting {name}...", file=sys.stderr, flush=True)
+    free = fit(func, degree)
+    f1 = func(Decimal(1))
+
+    # c1 = p(1) - ck; coeffs[k - 1] multiplies x^k
+    coeffs = [f1 - sum(free)] + free
+
+    # coefficient k's format holds max |h_k| over the domain
+    formats = []
+    for index in range(degree):
+        partial = coeffs[index:]
+        peak = sup_norm(lambda x, partial=partial: horner(partial, x))
+        int_bits = int((peak.ln() / LN2).to_integral_value(rounding=decimal.ROUND_FLOOR)) + 1
+        formats.append(precision - int_bits)
+
+    def to_fixed(value, frac_bits):
+        return (value * Decimal(2) ** frac_bits).to_integral_value(rounding=decimal.ROUND_HALF_EVEN)
+
+    def from_fixed(value, frac_bits):
+        return value / Decimal(2) ** frac_bits
+
+    # round c2..cn in their formats, then solve c1 from what they round to, so p(1) misses f(1) by c1's rounding alone
+    fixed = [None] + [to_fixed(c, frac_bits) for c, frac_bits in zip(coeffs[1:], formats[1:])]
+    stored_free = [from_fixed(value, frac_bits) for value, frac_bits in zip(fixed[1:], formats[1:])]
+    coeffs[0] = f1 - sum(stored_free)
+    fixed[0] = to_fixed(coeffs[0], formats[0])
+
+    # error of the coefficients as stored, before the kernel's own rounding
+    stored = [Decimal(0), from_fixed(fixed[0], formats[0])] + stored_free
+    print("// approx error:", f"{sup_norm(lambda x: horner(stored, x) - func(x)):.16e}")
+
+    def q(frac_bits):
+        return f"Q{precision - frac_bits}.{frac_bits}"
+
+    print(f"static constexpr auto poly_degree = {degree};")
+
+    print(f"{kernel['coeff_type']} const {kernel['class_name']}::poly_coeffs[] = {{")
+    for index in reversed(range(degree)):
+        c = coeffs[index]
+        print(f"    {fixed[index]}{kernel['coeff_suffix']}, // {c:.30e}*x^{index + 1} ({q(formats[index])})")
+    print("};")
+
+    print("static constexpr int_t poly_shifts[] = {")
+    for index in reversed(range(1, degree)):
+        curr, next = formats[index], formats[index - 1]
+        print(
+            f"    {curr - next}, // relative shift from x^{index + 1} ({q(curr)}) to x^{index} ({q(next)})"
+        )
+    print(f"    {formats[0] - 63}, // relative shift from x^1 ({q(formats[0])}) to output (Q1.63)")
+    print("};")
+
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2 or sys.argv[1] not in KERNELS:
+        sys.exit(f"usage: {sys.argv[0]} {{{'|'.join(KERNELS)}}}")
+    main(sys.argv[1])